@@ -26,6 +26,8 @@ public class NativeCallbacksWrapperGenerator : ISourceGenerator
 
         var compilation = context.Compilation;
         
+        GenerateExportedFunctionsTable(context, receiver.ClassesWithNativeCallbacks);
+        
         foreach (var classInfo in receiver.ClassesWithNativeCallbacks)
         {
             var model = compilation.GetSemanticModel(classInfo.ClassDeclaration.SyntaxTree);
@@ -160,6 +162,71 @@ public class NativeCallbacksWrapperGenerator : ISourceGenerator
             context.AddSource($"{classInfo.Name}.generated.cs", SourceText.From(sourceBuilder.ToString(), Encoding.UTF8));
         }
     }
+
+    // Every exported function gets an ordinal, by name so it's the same between builds of the same sources.
+    // Native fills a table with the function pointers in that order in one call, and the generated Assign copies them into the fields.
+    private static void GenerateExportedFunctionsTable(GeneratorExecutionContext context, List<ClassInfo> classes)
+    {
+        var exports = new List<(string Name, string FieldPath, string FieldType)>();
+
+        foreach (var classInfo in classes)
+        {
+            var model = context.Compilation.GetSemanticModel(classInfo.ClassDeclaration.SyntaxTree);
+            
+            foreach (var delegateInfo in classInfo.Delegates)
+            {
+                ITypeSymbol fieldType = model.GetTypeInfo(delegateInfo.FunctionPointerType).Type;
+                
+                if (fieldType == null)
+                {
+                    continue;
+                }
+                
+                exports.Add(($"{classInfo.Name}.{delegateInfo.Name}", 
+                    $"global::{classInfo.Namespace}.{classInfo.Name}.{delegateInfo.Name}", 
+                    fieldType.ToDisplayString(SymbolDisplayFormat.FullyQualifiedFormat)));
+            }
+        }
+
+        if (exports.Count == 0)
+        {
+            return;
+        }
+        
+        exports.Sort((a, b) => string.CompareOrdinal(a.Name, b.Name));
+        
+        var sourceBuilder = new StringBuilder();
+        sourceBuilder.AppendLine("namespace UnrealSharp.Interop");
+        sourceBuilder.AppendLine("{");
+        sourceBuilder.AppendLine("    internal static unsafe class ExportedFunctionsTable");
+        sourceBuilder.AppendLine("    {");
+        sourceBuilder.AppendLine($"        public const int Count = {exports.Count};");
+        sourceBuilder.AppendLine();
+        sourceBuilder.AppendLine("        // The names of all exported functions in ordinal order, each followed by a null terminator.");
+        sourceBuilder.Append("        public const string Names = \"");
+        
+        foreach (var export in exports)
+        {
+            sourceBuilder.Append(export.Name);
+            sourceBuilder.Append("\\0");
+        }
+        
+        sourceBuilder.AppendLine("\";");
+        sourceBuilder.AppendLine();
+        sourceBuilder.AppendLine("        public static void Assign(System.IntPtr* functions)");
+        sourceBuilder.AppendLine("        {");
+
+        for (int i = 0; i < exports.Count; i++)
+        {
+            sourceBuilder.AppendLine($"            {exports[i].FieldPath} = ({exports[i].FieldType}) (void*) functions[{i}];");
+        }
+        
+        sourceBuilder.AppendLine("        }");
+        sourceBuilder.AppendLine("    }");
+        sourceBuilder.AppendLine("}");
+        
+        context.AddSource("ExportedFunctionsTable.generated.cs", SourceText.From(sourceBuilder.ToString(), Encoding.UTF8));
+    }
 }
 
 internal class NativeCallbacksSyntaxReceiver : ISyntaxReceiver
@@ -223,6 +290,7 @@ internal class NativeCallbacksSyntaxReceiver : ISyntaxReceiver
             var delegateInfo = new DelegateInfo
             {
                 Name = fieldDeclaration.Declaration.Variables.First().Identifier.ValueText,
+                FunctionPointerType = functionPointerTypeSyntax,
                 Parameters = new List<DelegateParameterInfo>()
             };
 
@@ -258,6 +326,7 @@ internal struct ClassInfo
 internal struct DelegateInfo
 {
     public string Name { get; set; }
+    public FunctionPointerTypeSyntax FunctionPointerType { get; set; }
     public List<DelegateParameterInfo> Parameters { get; set; }
 }
 
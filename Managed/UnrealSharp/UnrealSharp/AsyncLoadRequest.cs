@@ -0,0 +1,140 @@
+﻿using System.Runtime.InteropServices;
+using UnrealSharp.Interop;
+using Object = UnrealSharp.CoreUObject.Object;
+
+namespace UnrealSharp;
+
+/// <summary>
+/// A pending async load of soft references. Native keeps a GCHandle to it and calls <see cref="OnLoaded"/> on the game thread once the load finishes.
+/// </summary>
+internal abstract class AsyncLoadRequest
+{
+    protected abstract unsafe void Complete(IntPtr* loadedObjects, int count);
+    
+    // Must be called on the game thread, which owns the streamable manager.
+    protected static int Start(AsyncLoadRequest request, PersistentObjectPtrData[] softObjectPtrs, int priority)
+    {
+        // Native takes the paths as FStrings, laid out the way it expects them.
+        UnmanagedArray[] paths = new UnmanagedArray[softObjectPtrs.Length];
+        
+        try
+        {
+            for (int i = 0; i < softObjectPtrs.Length; i++)
+            {
+                FSoftObjectPtrExporter.CallGetPath(ref softObjectPtrs[i], ref paths[i]);
+            }
+            
+            unsafe
+            {
+                // Freed by native once the load completes or is cancelled.
+                GCHandle requestHandle = GcHandleUtilities.AllocateStrongPointer(request);
+                delegate* unmanaged<IntPtr, IntPtr*, int, void> onLoaded = &OnLoaded;
+                
+                fixed (UnmanagedArray* pathsPtr = paths)
+                {
+                    return FSoftObjectPtrExporter.CallLoadAsync(pathsPtr, paths.Length, priority, GCHandle.ToIntPtr(requestHandle), (IntPtr) onLoaded);
+                }
+            }
+        }
+        finally
+        {
+            for (int i = 0; i < paths.Length; i++)
+            {
+                paths[i].Destroy();
+            }
+        }
+    }
+    
+    [UnmanagedCallersOnly]
+    private static unsafe void OnLoaded(IntPtr requestHandle, IntPtr* loadedObjects, int count)
+    {
+        InteropCounters.CountReverseCall(nameof(OnLoaded));
+        
+        try
+        {
+            if (GcHandleUtilities.GetObjectFromHandlePtr(requestHandle) is AsyncLoadRequest request)
+            {
+                request.Complete(loadedObjects, count);
+            }
+        }
+        catch (Exception ex)
+        {
+            Console.WriteLine($"Exception during async load completion: {ex}");
+        }
+    }
+}
+
+internal sealed class AsyncLoadRequest<T> : AsyncLoadRequest where T : Object
+{
+    private readonly TaskCompletionSource<T?[]> _completionSource = new(TaskCreationOptions.RunContinuationsAsynchronously);
+    
+    public static Task<T?[]> Start(PersistentObjectPtrData[] softObjectPtrs, int priority, CancellationToken cancellationToken)
+    {
+        if (cancellationToken.IsCancellationRequested)
+        {
+            return Task.FromCanceled<T?[]>(cancellationToken);
+        }
+        
+        if (softObjectPtrs.Length == 0)
+        {
+            return Task.FromResult(Array.Empty<T?>());
+        }
+        
+        AsyncLoadRequest<T> request = new AsyncLoadRequest<T>();
+        
+        // The streamable manager is only safe to touch on the game thread, so loads requested elsewhere start there.
+        if (UnrealSynchronizationContext.CurrentThread == NamedThread.GameThread)
+        {
+            request.Begin(softObjectPtrs, priority, cancellationToken);
+        }
+        else
+        {
+            UnrealSynchronizationContext.GetContext(NamedThread.GameThread).Post(_ => request.Begin(softObjectPtrs, priority, cancellationToken), null);
+        }
+        
+        return request._completionSource.Task;
+    }
+    
+    private void Begin(PersistentObjectPtrData[] softObjectPtrs, int priority, CancellationToken cancellationToken)
+    {
+        // Cancelled while waiting for the game thread.
+        if (cancellationToken.IsCancellationRequested)
+        {
+            _completionSource.TrySetCanceled(cancellationToken);
+            return;
+        }
+        
+        int requestId = Start(this, softObjectPtrs, priority);
+        
+        // Zero means the load already finished or there was nothing to load, so there's nothing left to cancel.
+        if (requestId == 0 || !cancellationToken.CanBeCanceled)
+        {
+            return;
+        }
+        
+        CancellationTokenRegistration registration = cancellationToken.Register(() =>
+        {
+            if (!_completionSource.TrySetCanceled(cancellationToken))
+            {
+                return;
+            }
+            
+            // Cancellation can come from any thread, the streamable manager is only safe to touch on the game thread.
+            UnrealSynchronizationContext.GetContext(NamedThread.GameThread).Post(_ => FSoftObjectPtrExporter.CallCancelAsyncLoad(requestId), null);
+        });
+        
+        _completionSource.Task.ContinueWith(_ => registration.Dispose(), TaskContinuationOptions.ExecuteSynchronously);
+    }
+    
+    protected override unsafe void Complete(IntPtr* loadedObjects, int count)
+    {
+        T?[] result = new T?[count];
+        
+        for (int i = 0; i < count; i++)
+        {
+            result[i] = GcHandleUtilities.GetObjectFromHandlePtr(loadedObjects[i]) as T;
+        }
+        
+        _completionSource.TrySetResult(result);
+    }
+}
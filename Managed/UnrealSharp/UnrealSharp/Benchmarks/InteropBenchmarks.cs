@@ -0,0 +1,195 @@
+using System.Diagnostics;
+using System.Runtime.InteropServices;
+using UnrealSharp.Interop;
+using Object = UnrealSharp.CoreUObject.Object;
+
+namespace UnrealSharp.Benchmarks;
+
+// Matches FCSBenchmarkRequest in CSPerfTests.cpp.
+[StructLayout(LayoutKind.Sequential)]
+internal unsafe struct BenchmarkRequest
+{
+    public char* Name;
+    public int Iterations;
+    public IntPtr Object;
+    public IntPtr ArrayProperty;
+    public IntPtr ArrayAddress;
+    public IntPtr MapProperty;
+    public IntPtr MapAddress;
+    public double NanosecondsPerOp;
+    public IntPtr DelegateHandle;
+    public IntPtr DelegateProperty;
+    public IntPtr DelegateAddress;
+}
+
+/// <summary>
+/// The managed half of the UnrealSharp.Perf automation tests.
+/// Native looks these methods up with LookupManagedMethod and calls them through InvokeManagedMethod.
+/// </summary>
+internal static class InteropBenchmarks
+{
+    private static unsafe void RunBenchmark(object target, IntPtr arguments, IntPtr returnValue)
+    {
+        BenchmarkRequest* request = (BenchmarkRequest*) arguments;
+        string name = new string(request->Name);
+        int iterations = request->Iterations;
+
+        request->NanosecondsPerOp = name switch
+        {
+            "Call.NoArguments" => Measure(iterations, () => UObjectExporter.CallGetGarbageFlag()),
+            "Call.Pointer" => MeasurePointerCall(iterations, request->Object),
+            "Call.Struct" => MeasureStructCall(iterations),
+            "Marshal.Object" => MeasureObjectMarshalling(iterations, request->Object),
+            "Marshal.String" => MeasureStringMarshalling(iterations),
+            "Array.Read" => MeasureArrayRead(iterations, request->ArrayProperty, request->ArrayAddress),
+            "Array.Write" => MeasureArrayWrite(iterations, request->ArrayProperty, request->ArrayAddress),
+            "Map.Read" => MeasureMapRead(iterations, request->MapProperty, request->MapAddress),
+            "WeakObject.Get" => MeasureWeakObjectGet(iterations, (UnrealSharpObject) target),
+            "WeakObject.GetNative" => MeasureWeakObjectGetNative(iterations, (UnrealSharpObject) target),
+            "WeakObject.IsValid" => MeasureWeakObjectIsValid(iterations, (UnrealSharpObject) target),
+            "WeakObject.IsValidNative" => MeasureWeakObjectIsValidNative(iterations, (UnrealSharpObject) target),
+            _ => throw new ArgumentException($"Unknown benchmark {name}.")
+        };
+    }
+
+    // Target of the InvokeManagedMethod benchmark, so only the cost of getting here is measured.
+    private static void Noop(object target, IntPtr arguments, IntPtr returnValue)
+    {
+    }
+
+    // Hands native a delegate for the InvokeDelegate benchmark. Native frees the handle.
+    private static unsafe void CreateDelegate(object target, IntPtr arguments, IntPtr returnValue)
+    {
+        BenchmarkRequest* request = (BenchmarkRequest*) arguments;
+        Action callback = () => { };
+        request->DelegateHandle = GCHandle.ToIntPtr(GcHandleUtilities.AllocateStrongPointer(callback));
+    }
+
+    // Binds a handler to the test actor's delegate for the Delegate.Broadcast benchmark, the same way MulticastDelegate.Add does.
+    private static unsafe void AddDelegateHandler(object target, IntPtr arguments, IntPtr returnValue)
+    {
+        BenchmarkRequest* request = (BenchmarkRequest*) arguments;
+        ManagedDelegateHandler.Bind(request->DelegateProperty, request->DelegateAddress, new BenchmarkDelegateHandler());
+    }
+    
+    // Unbinds the handlers again, which releases their handles.
+    private static unsafe void ClearDelegateHandlers(object target, IntPtr arguments, IntPtr returnValue)
+    {
+        BenchmarkRequest* request = (BenchmarkRequest*) arguments;
+        FMulticastDelegatePropertyExporter.CallClearDelegate(request->DelegateProperty, request->DelegateAddress);
+    }
+    
+    private static double MeasurePointerCall(int iterations, IntPtr nativeObject)
+    {
+        return Measure(iterations, () => UObjectExporter.CallNativeIsValid(nativeObject));
+    }
+
+    private static double MeasureStructCall(int iterations)
+    {
+        Name name = new Name("UnrealSharpPerf");
+        return Measure(iterations, () => FNameExporter.CallIsValid(name));
+    }
+
+    private static unsafe double MeasureObjectMarshalling(int iterations, IntPtr nativeObject)
+    {
+        IntPtr buffer = (IntPtr) (&nativeObject);
+        return Measure(iterations, () => ObjectMarshaller<Object>.FromNative(buffer, 0));
+    }
+
+    private static unsafe double MeasureStringMarshalling(int iterations)
+    {
+        UnmanagedArray nativeString = default;
+        IntPtr buffer = (IntPtr) (&nativeString);
+
+        double result = Measure(iterations, () =>
+        {
+            StringMarshaller.ToNative(buffer, 0, "UnrealSharpPerf");
+            return StringMarshaller.FromNative(buffer, 0);
+        });
+
+        StringMarshaller.DestructInstance(buffer, 0);
+        return result;
+    }
+
+    private static double MeasureArrayRead(int iterations, IntPtr arrayProperty, IntPtr arrayAddress)
+    {
+        Array<int> array = new Array<int>(arrayProperty, arrayAddress, BlittableMarshaller<int>.ToNative, BlittableMarshaller<int>.FromNative);
+        int count = array.Count;
+        return Measure(iterations, i => array[i % count]);
+    }
+
+    private static double MeasureArrayWrite(int iterations, IntPtr arrayProperty, IntPtr arrayAddress)
+    {
+        Array<int> array = new Array<int>(arrayProperty, arrayAddress, BlittableMarshaller<int>.ToNative, BlittableMarshaller<int>.FromNative);
+        int count = array.Count;
+        return Measure(iterations, i => array[i % count] = i);
+    }
+
+    private static double MeasureMapRead(int iterations, IntPtr mapProperty, IntPtr mapAddress)
+    {
+        Map<Name, int> map = new Map<Name, int>(mapProperty, mapAddress,
+            BlittableMarshaller<Name>.FromNative, BlittableMarshaller<Name>.ToNative,
+            BlittableMarshaller<int>.FromNative, BlittableMarshaller<int>.ToNative);
+
+        Name[] keys = map.Keys.ToArray();
+        return Measure(iterations, i => map[keys[i % keys.Length]]);
+    }
+
+    // The managed paths read the object array directly, when the engine version allows it. The native ones are the baseline.
+    private static double MeasureWeakObjectGet(int iterations, UnrealSharpObject target)
+    {
+        WeakObject<UnrealSharpObject> weakObject = new WeakObject<UnrealSharpObject>(target);
+        return Measure(iterations, () => weakObject.Object);
+    }
+
+    private static double MeasureWeakObjectGetNative(int iterations, UnrealSharpObject target)
+    {
+        WeakObject<UnrealSharpObject> weakObject = new WeakObject<UnrealSharpObject>(target);
+        return Measure(iterations, () => weakObject.GetNative());
+    }
+
+    private static double MeasureWeakObjectIsValid(int iterations, UnrealSharpObject target)
+    {
+        WeakObject<UnrealSharpObject> weakObject = new WeakObject<UnrealSharpObject>(target);
+        return Measure(iterations, () => weakObject.IsValid());
+    }
+
+    private static double MeasureWeakObjectIsValidNative(int iterations, UnrealSharpObject target)
+    {
+        WeakObject<UnrealSharpObject> weakObject = new WeakObject<UnrealSharpObject>(target);
+        return Measure(iterations, () => FWeakObjectPtrExporter.CallIsValid(weakObject.Data).ToManagedBool());
+    }
+
+    private static double Measure<TResult>(int iterations, Func<TResult> action)
+    {
+        return Measure(iterations, _ => action());
+    }
+
+    private static double Measure<TResult>(int iterations, Func<int, TResult> action)
+    {
+        // Warm up, so the first call's lookups and JIT don't count.
+        action(0);
+
+        long start = Stopwatch.GetTimestamp();
+
+        for (int i = 0; i < iterations; i++)
+        {
+            action(i);
+        }
+
+        return Stopwatch.GetElapsedTime(start).TotalNanoseconds / iterations;
+    }
+    
+    // Reads the first parameter of the broadcast, so the handler touches the parameter buffer like a generated invoker would.
+    private sealed class BenchmarkDelegateHandler : ManagedDelegateHandler
+    {
+        private readonly Action<int> _handler = _ => { };
+        
+        public override Delegate Handler => _handler;
+        
+        public override void Invoke(IntPtr parameters)
+        {
+            _handler(BlittableMarshaller<int>.FromNative(parameters, 0));
+        }
+    }
+}
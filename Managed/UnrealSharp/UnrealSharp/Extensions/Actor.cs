@@ -44,13 +44,14 @@ public partial class Actor
     /// <param name="action"> The action to bind the axis to </param>
     /// <param name="consumeInput"> Whether to consume the input </param>
     /// <param name="executeWhenPaused"> Whether to execute the action when paused </param>
-    public void BindAxis(string axisName, Action<float> action, bool consumeInput = false, bool executeWhenPaused = false)
+    /// <param name="batched"> Whether to deliver the value in one batch with other axes at the end of the world tick </param>
+    public void BindAxis(string axisName, Action<float> action, bool consumeInput = false, bool executeWhenPaused = false, bool batched = false)
     {
         InputComponent? inputComponent = InputComponent;
         
         if (inputComponent != null)
         {
-            inputComponent.BindAxis(axisName, action, consumeInput, executeWhenPaused);
+            inputComponent.BindAxis(axisName, action, consumeInput, executeWhenPaused, batched);
         }
     }
 
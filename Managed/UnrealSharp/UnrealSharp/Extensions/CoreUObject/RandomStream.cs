@@ -1,9 +1,7 @@
-using System.Runtime.InteropServices;
 using UnrealSharp.Interop;
 
 namespace UnrealSharp.CoreUObject;
 
-[StructLayout(LayoutKind.Sequential)]
 public partial struct RandomStream
 {
 	public RandomStream(int initialSeed)
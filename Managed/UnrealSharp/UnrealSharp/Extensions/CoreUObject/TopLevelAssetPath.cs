@@ -1,8 +1,5 @@
-using System.Runtime.InteropServices;
-
 namespace UnrealSharp.CoreUObject;
 
-[StructLayout(LayoutKind.Sequential)]
 public partial struct TopLevelAssetPath
 {
     public TopLevelAssetPath(Name packageName, Name assetName)
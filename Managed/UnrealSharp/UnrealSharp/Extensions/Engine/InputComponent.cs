@@ -1,12 +1,12 @@
-﻿using UnrealSharp.Interop;
-using Object = UnrealSharp.CoreUObject.Object;
+﻿using System.Runtime.InteropServices;
+using UnrealSharp.Interop;
 
 namespace UnrealSharp.Engine;
 
 public partial class InputComponent
 {
     /// <summary>
-    /// Bind an action to an input event.
+    /// Bind an action to an input event. The action can be any method or lambda and is called directly by native.
     /// </summary>
     /// <param name="actionName"> The name of the action. </param>
     /// <param name="inputEvent"> The input event to bind the action to. </param>
@@ -15,20 +15,21 @@ public partial class InputComponent
     /// <param name="executeWhenPaused"> Whether the action should execute when the game is paused. </param>
     public void BindAction(string actionName, EInputEvent inputEvent, Action action, bool consumeInput = false, bool executeWhenPaused = false)
     {
-        if (action.Target is Object unrealObject)
+        unsafe
         {
-            UInputComponentExporter.CallBindAction(NativeObject, 
+            delegate* unmanaged<IntPtr, void> invoke = &InputCallbacks.InvokeAction;
+            UInputComponentExporter.CallBindManagedAction(NativeObject, 
                 actionName, 
                 inputEvent, 
-                unrealObject.NativeObject, 
-                action.Method.Name,
+                AllocateCallbackHandle(action), 
+                (IntPtr) invoke,
                 consumeInput.ToNativeBool(),
                 executeWhenPaused.ToNativeBool());
         }
     }
     
     /// <summary>
-    /// Bind an action to an input event.
+    /// Bind an action to an input event. The action can be any method or lambda and is called directly by native.
     /// </summary>
     /// <param name="actionName"> The name of the action. </param>
     /// <param name="inputEvent"> The input event to bind the action to. </param>
@@ -37,35 +38,60 @@ public partial class InputComponent
     /// <param name="executeWhenPaused"> Whether the action should execute when the game is paused. </param>
     public void BindAction(string actionName, EInputEvent inputEvent, Action<InputCore.Key> action, bool consumeInput = false, bool executeWhenPaused = false)
     {
-        if (action.Target is Object unrealObject)
+        unsafe
         {
-            UInputComponentExporter.CallBindActionKeySignature(NativeObject, 
+            delegate* unmanaged<IntPtr, IntPtr, void> invoke = &InputCallbacks.InvokeKeyAction;
+            UInputComponentExporter.CallBindManagedActionKeySignature(NativeObject, 
                 actionName, 
                 inputEvent, 
-                unrealObject.NativeObject, 
-                action.Method.Name,
+                AllocateCallbackHandle(action), 
+                (IntPtr) invoke,
                 consumeInput.ToNativeBool(),
                 executeWhenPaused.ToNativeBool());
         }
     }
 
     /// <summary>
-    /// Bind an axis to an input event.
+    /// Bind an axis to an input event. The action can be any method or lambda and is called directly by native.
     /// </summary>
     /// <param name="axisName"> The name of the axis. </param>
     /// <param name="action"> The action to bind. </param>
     /// <param name="consumeInput"> Whether the input should be consumed. </param>
     /// <param name="executeWhenPaused"> Whether the action should execute when the game is paused. </param>
-    public void BindAxis(string axisName, Action<float> action, bool consumeInput = false, bool executeWhenPaused = false)
+    /// <param name="batched">
+    /// Whether to deliver the value together with the other batched axes in one call at the end of the world tick,
+    /// instead of immediately. Saves a native to managed transition per axis per frame, at the cost of a frame of latency.
+    /// </param>
+    public void BindAxis(string axisName, Action<float> action, bool consumeInput = false, bool executeWhenPaused = false, bool batched = false)
     {
-        if (action.Target is Object unrealObject)
+        unsafe
         {
-            UInputComponentExporter.CallBindAxis(NativeObject,
+            if (batched)
+            {
+                delegate* unmanaged<InputCallbacks.AxisValue*, int, void> invokeBatch = &InputCallbacks.InvokeAxisBatch;
+                UInputComponentExporter.CallBindManagedAxisBatched(NativeObject,
+                    axisName, 
+                    AllocateCallbackHandle(action), 
+                    (IntPtr) invokeBatch,
+                    consumeInput.ToNativeBool(),
+                    executeWhenPaused.ToNativeBool());
+                return;
+            }
+            
+            delegate* unmanaged<IntPtr, float, void> invoke = &InputCallbacks.InvokeAxis;
+            UInputComponentExporter.CallBindManagedAxis(NativeObject,
                 axisName, 
-                unrealObject.NativeObject, 
-                action.Method.Name,
+                AllocateCallbackHandle(action), 
+                (IntPtr) invoke,
                 consumeInput.ToNativeBool(),
                 executeWhenPaused.ToNativeBool());
         }
     }
+    
+    // Freed by native when the binding is removed along with the component.
+    // The handle is filed under the callback's assembly, so a bound component doesn't keep it from unloading.
+    private static IntPtr AllocateCallbackHandle(Delegate callback)
+    {
+        return GCHandle.ToIntPtr(GcHandleUtilities.AllocateStrongPointer(callback));
+    }
 }
\ No newline at end of file
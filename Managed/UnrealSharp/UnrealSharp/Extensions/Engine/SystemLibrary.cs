@@ -1,3 +1,4 @@
+using System.Runtime.InteropServices;
 using UnrealSharp.Interop;
 
 namespace UnrealSharp.Engine;
@@ -11,20 +12,96 @@ public partial class SystemLibrary
     /// <param name="time"> The time in seconds before the function is called. </param>
     /// <param name="bLooping"> Whether the timer should loop. </param>
     /// <param name="initialStartDelay"> The initial delay before the timer starts. </param>
-    /// <param name="initialStartDelayVariance"> The variance in the initial delay. </param>
     /// <exception cref="ArgumentException"> Thrown if the target of the action is not an UObject. </exception>
     public static TimerHandle SetTimer(Action action, float time, bool bLooping, float initialStartDelay = 0.000000f)
+    {
+        if (action.Target is not UnrealSharpObject owner)
+        {
+            throw new ArgumentException("The target of the action must be an UObject.");
+        }
+
+        return SetTimer(owner, action, time, bLooping, initialStartDelay);
+    }
+    
+    /// <summary>
+    /// Set a timer to call the specified action after the specified duration. The action can be any method or lambda.
+    /// Managed timers that fire in the same frame are called together at the end of the world tick.
+    /// </summary>
+    /// <param name="worldContextObject"> The object the timer belongs to. The timer stops firing once it's destroyed. </param>
+    /// <param name="action"> The function to call. </param>
+    /// <param name="time"> The time in seconds before the function is called. </param>
+    /// <param name="bLooping"> Whether the timer should loop. </param>
+    /// <param name="initialStartDelay"> The initial delay before the timer starts. </param>
+    public static TimerHandle SetTimer(UnrealSharpObject worldContextObject, Action action, float time, bool bLooping, float initialStartDelay = 0.000000f)
     {
         unsafe
         {
-            if (action.Target is not UnrealSharpObject owner)
-            {
-                throw new ArgumentException("The target of the action must be an UObject.");
-            }
-        
+            // Freed by native once the timer is cleared or has fired for the last time.
+            // The handle is filed under the action's assembly, so a looping timer doesn't keep it from unloading.
+            GCHandle callbackHandle = GcHandleUtilities.AllocateStrongPointer(action);
+            
             TimerHandle timerHandle = new TimerHandle();
-            UWorldExporter.CallSetTimer(owner.NativeObject, action.Method.Name, time, bLooping.ToNativeBool(), initialStartDelay, &timerHandle);
+            UWorldExporter.CallSetManagedTimer(worldContextObject.NativeObject, GCHandle.ToIntPtr(callbackHandle), time, bLooping.ToNativeBool(), initialStartDelay, &timerHandle);
             return timerHandle;
         }
     }
-}
\ No newline at end of file
+    
+    /// <summary>
+    /// Clears a timer set with <see cref="SetTimer(UnrealSharpObject, Action, float, bool, float)"/>.
+    /// </summary>
+    public static void ClearTimer(UnrealSharpObject worldContextObject, TimerHandle timerHandle)
+    {
+        unsafe
+        {
+            UWorldExporter.CallInvalidateTimer(worldContextObject.NativeObject, &timerHandle);
+        }
+    }
+    
+    /// <summary>
+    /// Returns a task that completes on the game thread after the specified duration.
+    /// </summary>
+    /// <param name="worldContextObject"> The object the timer belongs to. The task is cancelled if it's destroyed first. </param>
+    /// <param name="time"> The time in seconds to wait. </param>
+    /// <param name="cancellationToken"> Clears the timer and cancels the task. </param>
+    public static Task DelayAsync(UnrealSharpObject worldContextObject, float time, CancellationToken cancellationToken = default)
+    {
+        if (cancellationToken.IsCancellationRequested)
+        {
+            return Task.FromCanceled(cancellationToken);
+        }
+        
+        TaskCompletionSource completionSource = new TaskCompletionSource();
+        TimerHandle timerHandle = SetTimer(worldContextObject, () => completionSource.TrySetResult(), time, false);
+
+        // Timers with no duration or no world never fire.
+        if (!timerHandle.IsValid())
+        {
+            completionSource.TrySetResult();
+            return completionSource.Task;
+        }
+        
+        if (cancellationToken.CanBeCanceled)
+        {
+            CancellationTokenRegistration registration = cancellationToken.Register(() =>
+            {
+                if (!completionSource.TrySetCanceled(cancellationToken))
+                {
+                    return;
+                }
+                
+                // Cancellation can come from any thread, the timer manager is only safe to touch on the game thread.
+                UnrealSynchronizationContext.GetContext(NamedThread.GameThread).Post(_ =>
+                {
+                    if (worldContextObject.IsValid)
+                    {
+                        ClearTimer(worldContextObject, timerHandle);
+                    }
+                }, null);
+            });
+            
+            completionSource.Task.ContinueWith(_ => registration.Dispose(), TaskContinuationOptions.ExecuteSynchronously);
+        }
+        
+        return completionSource.Task;
+    }
+}
@@ -6,11 +6,21 @@ namespace UnrealSharp.EnhancedInput;
 
 public partial class EnhancedInputComponent
 {
+    /// <summary>
+    /// Bind a callback to an input action. The callback can be any method or lambda and is called directly by native.
+    /// </summary>
+    /// <param name="action"> The input action to bind to. </param>
+    /// <param name="triggerEvent"> The trigger event to bind the callback to. </param>
+    /// <param name="callback"> The callback to bind. </param>
     public void BindAction(InputAction action, ETriggerEvent triggerEvent, Action<InputActionValue> callback)
     {
-        if (callback.Target is CoreUObject.Object unrealObject)
+        unsafe
         {
-            UEnhancedInputComponentExporter.CallBindAction(NativeObject, action.NativeObject, triggerEvent, unrealObject.NativeObject, callback.Method.Name);
+            // Freed by native when the binding is removed along with the component.
+            // The handle is filed under the callback's assembly, so a bound component doesn't keep it from unloading.
+            GCHandle callbackHandle = GcHandleUtilities.AllocateStrongPointer(callback);
+            delegate* unmanaged<IntPtr, InputActionValue*, void> invoke = &InputCallbacks.InvokeActionValue;
+            UEnhancedInputComponentExporter.CallBindManagedAction(NativeObject, action.NativeObject, triggerEvent, GCHandle.ToIntPtr(callbackHandle), (IntPtr) invoke);
         }
     }
 }
\ No newline at end of file
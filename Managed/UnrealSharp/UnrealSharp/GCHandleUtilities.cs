@@ -15,9 +15,40 @@ public static class GcHandleUtilities
 
     private static AssemblyLoadContext? GetAssemblyLoadContext(object obj)
     {
+        // Delegate types live in CoreLib, it's the code they call that keeps an assembly loaded.
+        if (obj is Delegate @delegate)
+        {
+            return GetAssemblyLoadContext(@delegate);
+        }
+        
         return AssemblyLoadContext.GetLoadContext(obj.GetType().Assembly);
     }
 
+    private static AssemblyLoadContext? GetAssemblyLoadContext(Delegate @delegate)
+    {
+        foreach (Delegate invocation in @delegate.GetInvocationList())
+        {
+            // The method is usually declared in user code, but a user type can also inherit an instance method.
+            if (GetCollectibleLoadContext(invocation.Method.DeclaringType) is { } methodAlc)
+            {
+                return methodAlc;
+            }
+            
+            if (GetCollectibleLoadContext(invocation.Target?.GetType()) is { } targetAlc)
+            {
+                return targetAlc;
+            }
+        }
+        
+        return AssemblyLoadContext.GetLoadContext(@delegate.GetType().Assembly);
+    }
+
+    private static AssemblyLoadContext? GetCollectibleLoadContext(Type? type)
+    {
+        AssemblyLoadContext? alc = type != null ? AssemblyLoadContext.GetLoadContext(type.Assembly) : null;
+        return alc is { IsCollectible: true } ? alc : null;
+    }
+
     [MethodImpl(MethodImplOptions.NoInlining)]
     private static void OnAlcUnloading(AssemblyLoadContext alc)
     {
@@ -32,7 +63,25 @@ public static class GcHandleUtilities
             return GCHandle.Alloc(value, GCHandleType.Normal);
         }
 
-        var alc = GetAssemblyLoadContext(value);
+        return AllocateStrongPointer(value, GetAssemblyLoadContext(value));
+    }
+
+    /// <summary>
+    /// Allocates a strong handle to a wrapper that calls <paramref name="callback"/>, released when the callback's assembly is unloaded.
+    /// The wrapper's own type usually lives in this assembly, which is never unloaded.
+    /// </summary>
+    public static GCHandle AllocateStrongPointer(object value, Delegate callback)
+    {
+        if (!AlcReloadCfg.IsAlcReloadingEnabled)
+        {
+            return GCHandle.Alloc(value, GCHandleType.Normal);
+        }
+
+        return AllocateStrongPointer(value, GetAssemblyLoadContext(callback));
+    }
+
+    private static GCHandle AllocateStrongPointer(object value, AssemblyLoadContext? alc)
+    {
         if (alc == null || IsAlcBeingUnloaded(alc))
         {
             return GCHandle.Alloc(value, GCHandleType.Weak);
@@ -60,13 +109,12 @@ public static class GcHandleUtilities
     {
         if (AlcReloadCfg.IsAlcReloadingEnabled)
         {
-            var target = handle.Target;
-            if (target != null)
+            // Not necessarily filed under the target's own context, see the callback overload of AllocateStrongPointer.
+            foreach (var strongReferences in StrongReferencesByAlc.Values)
             {
-                var alc = GetAssemblyLoadContext(target);
-                if (alc != null && StrongReferencesByAlc.TryGetValue(alc, out var strongReferences))
+                if (strongReferences.TryRemove(handle, out _))
                 {
-                    strongReferences.TryRemove(handle, out _);
+                    break;
                 }
             }
         }
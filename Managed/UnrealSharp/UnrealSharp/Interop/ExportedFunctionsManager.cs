@@ -1,83 +1,29 @@
-using System.Diagnostics;
-using System.Reflection;
-using System.Runtime.InteropServices;
-
 namespace UnrealSharp.Interop;
 
 public static class ExportedFunctionsManager
 {
-    [UnmanagedFunctionPointer(CallingConvention.Cdecl)] 
-    delegate void NativeFunctionDelegate(IntPtr nativeFunctionPtr);
-    
-    [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
-    unsafe delegate void RegisterFunctionsCallback(IntPtr nativeFunctionPtr, char* nativeFunctionName);
-    
-    private static readonly Dictionary<string, FieldInfo> UnmanagedDelegates = new();
-
-    public static void Initialize(IntPtr NativeExportFunctionsPtr)
+    public static unsafe void Initialize(IntPtr nativeExportFunctionsPtr)
     {
         try
         {
-            unsafe
-            {
-                foreach (Type type in Assembly.GetExecutingAssembly().GetTypes())
-                {
-                    if (!Attribute.IsDefined(type, typeof(NativeCallbacksAttribute)))
-                    {
-                        continue;
-                    }
-
-                    foreach (FieldInfo field in type.GetFields(BindingFlags.Public | BindingFlags.NonPublic |
-                                                               BindingFlags.Static))
-                    {
-                        if (!field.IsStatic || !field.FieldType.IsUnmanagedFunctionPointer)
-                        {
-                            continue;
-                        }
-                        
-                        UnmanagedDelegates.TryAdd(type.Name + "." + field.Name, field);
-                    }
-                }
-
+            var exportFunctions = (delegate* unmanaged<char*, int, IntPtr*, int>) nativeExportFunctionsPtr;
+            IntPtr* functions = stackalloc IntPtr[ExportedFunctionsTable.Count];
             
-                NativeFunctionDelegate registerFunctions =
-                    Marshal.GetDelegateForFunctionPointer<NativeFunctionDelegate>(NativeExportFunctionsPtr);
-                IntPtr registerFunctionsCallback =
-                    Marshal.GetFunctionPointerForDelegate<RegisterFunctionsCallback>(RegisterFunctions);
-
-                registerFunctions(registerFunctionsCallback);
+            fixed (char* names = ExportedFunctionsTable.Names)
+            {
+                int missingFunctions = exportFunctions(names, ExportedFunctionsTable.Count, functions);
                 
-                foreach (KeyValuePair<string, FieldInfo> unmanagedDelegate in UnmanagedDelegates)
+                if (missingFunctions > 0)
                 {
-                    if (unmanagedDelegate.Value.GetValue(null) == null)
-                    {
-                        Console.WriteLine($"Failed to initialize {unmanagedDelegate.Key}.");
-                    }
+                    Console.WriteLine($"Failed to initialize {missingFunctions} native functions, see the Unreal log for which.");
                 }
             }
+            
+            ExportedFunctionsTable.Assign(functions);
         }
         catch (Exception ex)
         {
             Console.WriteLine($"Failed to initialize native functions: {ex}");
         }
     }
-
-    private static unsafe void RegisterFunctions(IntPtr nativeFunctionPtr, char* nativeFunctionName)
-    {
-        string nativeFunctionNameString = new string(nativeFunctionName);
-        
-        try
-        {
-            if (!UnmanagedDelegates.TryGetValue(nativeFunctionNameString, out FieldInfo unmanagedDelegate))
-            {
-                throw new Exception($"Failed to find {nativeFunctionNameString} in {nameof(UnmanagedDelegates)}.");
-            }
-            
-            unmanagedDelegate.SetValue(null, nativeFunctionPtr);
-        }
-        catch (Exception e)
-        {
-            Console.WriteLine($"Failed to register native function \"{nativeFunctionNameString}\" exception: {e}");
-        }
-    }
 }
\ No newline at end of file
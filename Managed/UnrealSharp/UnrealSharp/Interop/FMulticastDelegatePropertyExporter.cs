@@ -9,4 +9,7 @@ public static unsafe partial class FMulticastDelegatePropertyExporter
     public static delegate* unmanaged<IntPtr, IntPtr, IntPtr, void> BroadcastDelegate;
     public static delegate* unmanaged<IntPtr, IntPtr> GetSignatureFunction;
     public static delegate* unmanaged<IntPtr, IntPtr, IntPtr, string, NativeBool> ContainsDelegate; 
+    public static delegate* unmanaged<IntPtr, IntPtr, IntPtr, IntPtr, void> AddManagedDelegate;
+    public static delegate* unmanaged<IntPtr, IntPtr, IntPtr, void> RemoveManagedDelegate;
+    public static delegate* unmanaged<IntPtr, IntPtr, int, IntPtr> GetManagedDelegateHandler;
 }
\ No newline at end of file
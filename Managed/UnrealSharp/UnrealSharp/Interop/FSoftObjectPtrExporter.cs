@@ -4,4 +4,7 @@ namespace UnrealSharp.Interop;
 public static unsafe partial class FSoftObjectPtrExporter
 {
     public static delegate* unmanaged<ref PersistentObjectPtrData, IntPtr> LoadSynchronous;
+    public static delegate* unmanaged<ref PersistentObjectPtrData, ref UnmanagedArray, void> GetPath;
+    public static delegate* unmanaged<UnmanagedArray*, int, int, IntPtr, IntPtr, int> LoadAsync;
+    public static delegate* unmanaged<int, void> CancelAsyncLoad;
 }
\ No newline at end of file
@@ -8,4 +8,6 @@ public static unsafe partial class FWeakObjectPtrExporter
     public static delegate* unmanaged<WeakObjectData, NativeBool> IsValid;
     public static delegate* unmanaged<WeakObjectData, NativeBool> IsStale;
     public static delegate* unmanaged<WeakObjectData, WeakObjectData, NativeBool> NativeEquals;
+    public static delegate* unmanaged<ref ObjectArrayLayout, NativeBool> GetObjectArrayLayout;
+    public static delegate* unmanaged<int, IntPtr> GetObjectItemChunk;
 }
\ No newline at end of file
@@ -0,0 +1,111 @@
+﻿using System.Runtime.InteropServices;
+using UnrealSharp.EnhancedInput;
+
+namespace UnrealSharp.Interop;
+
+/// <summary>
+/// Entry points native input bindings call with the GCHandle of the bound managed delegate,
+/// so input reaches managed code without going through a UFunction.
+/// </summary>
+internal static unsafe class InputCallbacks
+{
+    [StructLayout(LayoutKind.Sequential)]
+    internal struct AxisValue
+    {
+        public IntPtr Callback;
+        public float Value;
+    }
+    
+    [UnmanagedCallersOnly]
+    internal static void InvokeAction(IntPtr callbackHandle)
+    {
+        InteropCounters.CountReverseCall(nameof(InvokeAction));
+        
+        try
+        {
+            if (GcHandleUtilities.GetObjectFromHandlePtr(callbackHandle) is Action callback)
+            {
+                callback();
+            }
+        }
+        catch (Exception ex)
+        {
+            Console.WriteLine($"Exception during input action: {ex}");
+        }
+    }
+    
+    [UnmanagedCallersOnly]
+    internal static void InvokeKeyAction(IntPtr callbackHandle, IntPtr key)
+    {
+        InteropCounters.CountReverseCall(nameof(InvokeKeyAction));
+        
+        try
+        {
+            if (GcHandleUtilities.GetObjectFromHandlePtr(callbackHandle) is Action<InputCore.Key> callback)
+            {
+                callback(InputCore.KeyMarshaller.FromNative(key, 0));
+            }
+        }
+        catch (Exception ex)
+        {
+            Console.WriteLine($"Exception during input action: {ex}");
+        }
+    }
+    
+    [UnmanagedCallersOnly]
+    internal static void InvokeAxis(IntPtr callbackHandle, float value)
+    {
+        InteropCounters.CountReverseCall(nameof(InvokeAxis));
+        
+        try
+        {
+            if (GcHandleUtilities.GetObjectFromHandlePtr(callbackHandle) is Action<float> callback)
+            {
+                callback(value);
+            }
+        }
+        catch (Exception ex)
+        {
+            Console.WriteLine($"Exception during input axis: {ex}");
+        }
+    }
+    
+    [UnmanagedCallersOnly]
+    internal static void InvokeAxisBatch(AxisValue* axisValues, int count)
+    {
+        InteropCounters.CountReverseCall(nameof(InvokeAxisBatch));
+        
+        for (int i = 0; i < count; i++)
+        {
+            try
+            {
+                if (GcHandleUtilities.GetObjectFromHandlePtr(axisValues[i].Callback) is Action<float> callback)
+                {
+                    callback(axisValues[i].Value);
+                }
+            }
+            catch (Exception ex)
+            {
+                Console.WriteLine($"Exception during input axis: {ex}");
+            }
+        }
+    }
+    
+    [UnmanagedCallersOnly]
+    internal static void InvokeActionValue(IntPtr callbackHandle, InputActionValue* value)
+    {
+        InteropCounters.CountReverseCall(nameof(InvokeActionValue));
+        
+        try
+        {
+            if (GcHandleUtilities.GetObjectFromHandlePtr(callbackHandle) is Action<InputActionValue> callback)
+            {
+                callback(*value);
+            }
+        }
+        catch (Exception ex)
+        {
+            Console.WriteLine($"Exception during input action: {ex}");
+        }
+    }
+}
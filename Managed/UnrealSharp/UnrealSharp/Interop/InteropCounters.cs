@@ -0,0 +1,24 @@
+﻿using System.Diagnostics.Metrics;
+
+namespace UnrealSharp.Interop;
+
+/// <summary>
+/// Counts calls from native into managed code, published as the "UnrealSharp.Interop" meter.
+/// Costs a single check per call until a listener such as dotnet-counters subscribes.
+/// </summary>
+internal static class InteropCounters
+{
+    private static readonly Meter Meter = new("UnrealSharp.Interop");
+    
+    private static readonly Counter<long> ReverseCalls = Meter.CreateCounter<long>("reverse-calls", description: "Calls from native into managed entry points.");
+    
+    public static void CountReverseCall(string entryPoint)
+    {
+        if (!ReverseCalls.Enabled)
+        {
+            return;
+        }
+        
+        ReverseCalls.Add(1, new KeyValuePair<string, object?>("entry-point", entryPoint));
+    }
+}
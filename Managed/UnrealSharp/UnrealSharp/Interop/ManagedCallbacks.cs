@@ -5,11 +5,15 @@ namespace UnrealSharp.Interop;
 [StructLayout(LayoutKind.Sequential)]
 public unsafe struct ManagedCallbacks
 {
-    public delegate* unmanaged<IntPtr, IntPtr, IntPtr> ScriptManagerBridge_CreateManagedObject;
+    public delegate* unmanaged<IntPtr, IntPtr, int*, IntPtr> ScriptManagerBridge_CreateManagedObject;
     public delegate* unmanaged<IntPtr, delegate*<object, IntPtr, IntPtr, void>, IntPtr, IntPtr, IntPtr, int> ScriptManagerBridge_InvokeManagedMethod;
     public delegate* unmanaged<IntPtr, void> ScriptManagerBridge_InvokeDelegate;
     public delegate* unmanaged<IntPtr, char*, IntPtr> ScriptManagerBridge_LookupManagedMethod;
     public delegate* unmanaged<IntPtr, char*, char*, IntPtr> ScriptManagedBridge_LookupManagedType;
+    public delegate* unmanaged<float, int*, int> ScriptManagerBridge_RunGameThreadContinuations;
+    public delegate* unmanaged<IntPtr*, int, IntPtr, int> ScriptManagerBridge_InvokeTimerCallbacks;
+    public delegate* unmanaged<ManagedGCStats*, void> ScriptManagerBridge_GetGCStats;
+    public delegate* unmanaged<int, ManagedGCSettings*, void> ScriptManagerBridge_CoordinateGC;
     public delegate* unmanaged<IntPtr, void> ScriptManagedBridge_Dispose;
 
     public static ManagedCallbacks Create()
@@ -21,6 +25,10 @@ public unsafe struct ManagedCallbacks
             ScriptManagerBridge_InvokeDelegate = &UnmanagedCallbacks.InvokeDelegate,
             ScriptManagerBridge_LookupManagedMethod = &UnmanagedCallbacks.LookupManagedMethod,
             ScriptManagedBridge_LookupManagedType = &UnmanagedCallbacks.LookupManagedType,
+            ScriptManagerBridge_RunGameThreadContinuations = &UnmanagedCallbacks.RunGameThreadContinuations,
+            ScriptManagerBridge_InvokeTimerCallbacks = &UnmanagedCallbacks.InvokeTimerCallbacks,
+            ScriptManagerBridge_GetGCStats = &UnmanagedCallbacks.GetGCStats,
+            ScriptManagerBridge_CoordinateGC = &UnmanagedCallbacks.CoordinateGC,
             ScriptManagedBridge_Dispose = &UnmanagedCallbacks.Dispose,
         };
     }
@@ -5,4 +5,5 @@ public static unsafe partial class UCoreUObjectExporter
 {
     public static delegate* unmanaged<string, IntPtr> GetNativeClassFromName;
     public static delegate* unmanaged<string, IntPtr> GetNativeStructFromName;
+    public static delegate* unmanaged<int*> GetTypeCacheGeneration;
 }
\ No newline at end of file
@@ -6,4 +6,5 @@ namespace UnrealSharp.Interop;
 public static unsafe partial class UEnhancedInputComponentExporter
 {
     public static delegate* unmanaged<IntPtr, IntPtr, ETriggerEvent, IntPtr, Name, void> BindAction;
+    public static delegate* unmanaged<IntPtr, IntPtr, ETriggerEvent, IntPtr, IntPtr, void> BindManagedAction;
 }
\ No newline at end of file
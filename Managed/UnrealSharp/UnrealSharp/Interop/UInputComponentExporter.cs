@@ -9,4 +9,8 @@ public static unsafe partial class UInputComponentExporter
     public static delegate* unmanaged<IntPtr, Name, EInputEvent, IntPtr, Name, NativeBool, NativeBool, void> BindAction;
     public static delegate* unmanaged<IntPtr, Name, EInputEvent, IntPtr, Name, NativeBool, NativeBool, void> BindActionKeySignature;
     public static delegate* unmanaged<IntPtr, Name, IntPtr, Name, NativeBool, NativeBool, void> BindAxis;
+    public static delegate* unmanaged<IntPtr, Name, EInputEvent, IntPtr, IntPtr, NativeBool, NativeBool, void> BindManagedAction;
+    public static delegate* unmanaged<IntPtr, Name, EInputEvent, IntPtr, IntPtr, NativeBool, NativeBool, void> BindManagedActionKeySignature;
+    public static delegate* unmanaged<IntPtr, Name, IntPtr, IntPtr, NativeBool, NativeBool, void> BindManagedAxis;
+    public static delegate* unmanaged<IntPtr, Name, IntPtr, IntPtr, NativeBool, NativeBool, void> BindManagedAxisBatched;
 }
\ No newline at end of file
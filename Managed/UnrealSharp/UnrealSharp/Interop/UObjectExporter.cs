@@ -9,4 +9,5 @@ public static unsafe partial class UObjectExporter
     public static delegate* unmanaged<IntPtr, IntPtr, IntPtr, void> InvokeNativeFunction;
     public static delegate* unmanaged<IntPtr, IntPtr, IntPtr, void> InvokeNativeStaticFunction;
     public static delegate* unmanaged<IntPtr, bool> NativeIsValid;
+    public static delegate* unmanaged<int> GetGarbageFlag;
 }
\ No newline at end of file
@@ -1,13 +1,16 @@
 ﻿using System.Reflection;
 using System.Runtime.InteropServices;
+using System.Text;
 
 namespace UnrealSharp.Interop;
 
 public static class UnmanagedCallbacks
 {
     [UnmanagedCallersOnly]
-    internal static IntPtr CreateNewManagedObject(IntPtr nativeObject, IntPtr typeHandle)
+    internal static unsafe IntPtr CreateNewManagedObject(IntPtr nativeObject, IntPtr typeHandle, int* objectFlags)
     {
+        InteropCounters.CountReverseCall(nameof(CreateNewManagedObject));
+        
         try
         {
             if (nativeObject == IntPtr.Zero)
@@ -29,7 +32,7 @@ public static class UnmanagedCallbacks
                 throw new ArgumentNullException(nameof(nativeObject));
             }
 
-            return UnrealSharpObject.Create(typeToCreate, nativeObject);
+            return UnrealSharpObject.Create(typeToCreate, nativeObject, objectFlags);
         }
         catch (Exception ex)
         {
@@ -42,6 +45,8 @@ public static class UnmanagedCallbacks
     [UnmanagedCallersOnly]
     public static unsafe IntPtr LookupManagedMethod(IntPtr typeHandlePtr, char* methodName)
     {
+        InteropCounters.CountReverseCall(nameof(LookupManagedMethod));
+        
         try
         {
             string methodNameString = new string(methodName);
@@ -81,6 +86,8 @@ public static class UnmanagedCallbacks
     [UnmanagedCallersOnly]
     public static unsafe IntPtr LookupManagedType(IntPtr assemblyHandle, char* typeNamespace, char* typeName)
     {
+        InteropCounters.CountReverseCall(nameof(LookupManagedType));
+        
         try
         {
             Assembly? loadedAssembly = GCHandle.FromIntPtr(assemblyHandle).Target as Assembly;
@@ -125,6 +132,8 @@ public static class UnmanagedCallbacks
         IntPtr returnValueBuffer, 
         IntPtr exceptionTextBuffer)
     {
+        InteropCounters.CountReverseCall(nameof(InvokeManagedMethod));
+        
         try
         {
             object? managedObject = GCHandle.FromIntPtr(managedObjectHandle).Target;
@@ -148,6 +157,8 @@ public static class UnmanagedCallbacks
     [UnmanagedCallersOnly]
     public static void InvokeDelegate(IntPtr delegatePtr)
     {
+        InteropCounters.CountReverseCall(nameof(InvokeDelegate));
+        
         try
         {
             if (delegatePtr == IntPtr.Zero)
@@ -170,9 +181,80 @@ public static class UnmanagedCallbacks
         }
     }
 
+    [UnmanagedCallersOnly]
+    public static unsafe int RunGameThreadContinuations(float budgetMs, int* ranCount)
+    {
+        InteropCounters.CountReverseCall(nameof(RunGameThreadContinuations));
+        
+        int remainingCount = UnrealSynchronizationContext.RunGameThreadContinuations(budgetMs, out int ranContinuations);
+        *ranCount = ranContinuations;
+        return remainingCount;
+    }
+
+    // Returns how many callbacks threw, their exceptions are written to the buffer. The rest still run.
+    [UnmanagedCallersOnly]
+    public static unsafe int InvokeTimerCallbacks(IntPtr* callbackHandles, int count, IntPtr exceptionTextBuffer)
+    {
+        InteropCounters.CountReverseCall(nameof(InvokeTimerCallbacks));
+        
+        StringBuilder? exceptionText = null;
+        int failedCount = 0;
+        
+        for (int i = 0; i < count; i++)
+        {
+            try
+            {
+                if (GcHandleUtilities.GetObjectFromHandlePtr(callbackHandles[i]) is Action callback)
+                {
+                    callback();
+                }
+            }
+            catch (Exception ex)
+            {
+                exceptionText ??= new StringBuilder();
+                exceptionText.AppendLine(ex.ToString());
+                failedCount++;
+                
+                Console.WriteLine($"Exception during timer callback: {ex}");
+            }
+        }
+        
+        if (exceptionText != null)
+        {
+            StringMarshaller.ToNative(exceptionTextBuffer, 0, exceptionText.ToString());
+        }
+        
+        return failedCount;
+    }
+
+    [UnmanagedCallersOnly]
+    internal static unsafe void GetGCStats(ManagedGCStats* stats)
+    {
+        InteropCounters.CountReverseCall(nameof(GetGCStats));
+        
+        *stats = ManagedGCStats.Collect();
+    }
+
+    [UnmanagedCallersOnly]
+    internal static unsafe void CoordinateGC(int gcEvent, ManagedGCSettings* settings)
+    {
+        InteropCounters.CountReverseCall(nameof(CoordinateGC));
+        
+        try
+        {
+            ManagedGCCoordinator.HandleEvent((ManagedGCEvent) gcEvent, *settings);
+        }
+        catch (Exception ex)
+        {
+            Console.WriteLine($"Exception during CoordinateGC: {ex}");
+        }
+    }
+
     [UnmanagedCallersOnly]
     public static void Dispose(IntPtr handle)
     {
+        InteropCounters.CountReverseCall(nameof(Dispose));
+        
         if (handle == IntPtr.Zero)
         {
             return;
@@ -0,0 +1,54 @@
+﻿using System.Runtime.InteropServices;
+
+using UnrealSharp.Interop;
+
+namespace UnrealSharp;
+
+/// <summary>
+/// A managed handler bound to a multicast delegate through a native UCSManagedDelegateTarget.
+/// Native keeps a GCHandle to it and calls <see cref="InvokeHandler"/> with the delegate's parameter buffer on broadcast.
+/// </summary>
+internal abstract class ManagedDelegateHandler
+{
+    public abstract Delegate Handler { get; }
+    
+    public abstract void Invoke(IntPtr parameters);
+
+    /// <summary>
+    /// Binds the handler to a native multicast delegate.
+    /// The handle is filed under the assembly of the bound <see cref="Handler"/>, so unloading that assembly releases it
+    /// even though native keeps the target alive for as long as the delegate's owner.
+    /// </summary>
+    public static unsafe void Bind(IntPtr nativeProperty, IntPtr nativeDelegate, ManagedDelegateHandler handler)
+    {
+        GCHandle handle = GcHandleUtilities.AllocateStrongPointer(handler, handler.Handler);
+        
+        delegate* unmanaged<IntPtr, IntPtr, IntPtr, int> invoker = &InvokeHandler;
+        FMulticastDelegatePropertyExporter.CallAddManagedDelegate(nativeProperty, nativeDelegate, GCHandle.ToIntPtr(handle), (IntPtr) invoker);
+    }
+
+    [UnmanagedCallersOnly]
+    internal static int InvokeHandler(IntPtr handlerHandle, IntPtr parameters, IntPtr exceptionTextBuffer)
+    {
+        InteropCounters.CountReverseCall(nameof(InvokeHandler));
+        
+        try
+        {
+            // The handle is released when the bound handler's assembly unloads, which leaves it empty until native releases the target.
+            if (GcHandleUtilities.GetObjectFromHandlePtr(handlerHandle) is not ManagedDelegateHandler handler)
+            {
+                return 0;
+            }
+            
+            handler.Invoke(parameters);
+        }
+        catch (Exception ex)
+        {
+            StringMarshaller.ToNative(exceptionTextBuffer, 0, ex.ToString());
+            Console.WriteLine($"Exception during managed delegate handler: {ex}");
+            return 1;
+        }
+        
+        return 0;
+    }
+}
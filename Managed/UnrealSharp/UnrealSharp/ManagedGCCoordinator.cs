@@ -0,0 +1,100 @@
+using System.Runtime;
+using System.Runtime.InteropServices;
+
+namespace UnrealSharp;
+
+// Matches ECSManagedGCEvent in CSManagedGCCoordinator.h.
+public enum ManagedGCEvent
+{
+    Initialize,
+    PreEngineGC,
+    PostEngineGC,
+    LevelLoaded,
+}
+
+// Matches FCSManagedGCSettings in CSManagedGCCoordinator.h.
+[StructLayout(LayoutKind.Sequential)]
+public struct ManagedGCSettings
+{
+    public long NoGCRegionBytes;
+    public int PostEngineGCGeneration;
+    public NativeBool SustainedLowLatency;
+    public NativeBool FullCollectionAfterLevelLoad;
+}
+
+/// <summary>
+/// Moves .NET collections out of the engine's GC, when native enables it in the UnrealSharp settings.
+/// </summary>
+internal static class ManagedGCCoordinator
+{
+    private static bool _inNoGCRegion;
+    private static bool _noGCRegionUnsupported;
+
+    public static void HandleEvent(ManagedGCEvent gcEvent, in ManagedGCSettings settings)
+    {
+        switch (gcEvent)
+        {
+            case ManagedGCEvent.Initialize:
+                if (settings.SustainedLowLatency == NativeBool.True)
+                {
+                    GCSettings.LatencyMode = GCLatencyMode.SustainedLowLatency;
+                }
+                break;
+            case ManagedGCEvent.PreEngineGC:
+                BeginNoGCRegion(settings.NoGCRegionBytes);
+                break;
+            case ManagedGCEvent.PostEngineGC:
+                EndNoGCRegion();
+                
+                // The engine's GC just released the wrappers of the objects it deleted, collect them while this frame is already long.
+                GC.Collect(settings.PostEngineGCGeneration, GCCollectionMode.Forced, true);
+                break;
+            case ManagedGCEvent.LevelLoaded:
+                if (settings.FullCollectionAfterLevelLoad == NativeBool.True)
+                {
+                    GCSettings.LargeObjectHeapCompactionMode = GCLargeObjectHeapCompactionMode.CompactOnce;
+                    GC.Collect(GC.MaxGeneration, GCCollectionMode.Forced, true, true);
+                }
+                break;
+        }
+    }
+
+    private static void BeginNoGCRegion(long totalSize)
+    {
+        if (totalSize <= 0 || _inNoGCRegion || _noGCRegionUnsupported)
+        {
+            return;
+        }
+
+        try
+        {
+            // Never allow a full blocking collection to make room, that's the pause this is meant to avoid.
+            _inNoGCRegion = GC.TryStartNoGCRegion(totalSize, true);
+        }
+        catch (ArgumentOutOfRangeException)
+        {
+            _noGCRegionUnsupported = true;
+            Console.WriteLine($"A no GC region of {totalSize} bytes is larger than the runtime allows. Lower NoGCRegionSize in the UnrealSharp settings.");
+        }
+        catch (InvalidOperationException)
+        {
+            // Game code already started its own region.
+        }
+    }
+
+    private static void EndNoGCRegion()
+    {
+        if (!_inNoGCRegion)
+        {
+            return;
+        }
+
+        _inNoGCRegion = false;
+
+        // The region ends on its own if more than its size was allocated, ending it again would throw.
+        if (GCSettings.LatencyMode == GCLatencyMode.NoGCRegion)
+        {
+            GC.EndNoGCRegion();
+        }
+    }
+}
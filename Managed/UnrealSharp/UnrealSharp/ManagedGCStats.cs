@@ -0,0 +1,49 @@
+using System.Runtime.InteropServices;
+
+namespace UnrealSharp;
+
+/// <summary>
+/// GC and allocation counters native reads once per frame. Matches FCSManagedGCStats in CSManagedStats.h.
+/// Everything but the heap sizes is cumulative, native publishes the difference between frames.
+/// Each collection is counted once, under the highest generation it collected.
+/// </summary>
+[StructLayout(LayoutKind.Sequential)]
+public struct ManagedGCStats
+{
+    public long HeapSizeBytes;
+    public long CommittedBytes;
+    public long TotalAllocatedBytes;
+    public double TotalPauseMs;
+    public int Gen0Collections;
+    public int Gen1Collections;
+    public int Gen2Collections;
+
+    private static int _lastCollectionCount = -1;
+    private static long _committedBytes;
+
+    internal static ManagedGCStats Collect()
+    {
+        // A collection of a generation also collects the younger ones, so CollectionCount(0) counts every collection.
+        int collections = GC.CollectionCount(0);
+        int gen1AndUpCollections = GC.CollectionCount(1);
+        int gen2Collections = GC.CollectionCount(2);
+
+        // The committed size only changes with a collection, and getting it is more expensive than the counters.
+        if (collections != _lastCollectionCount)
+        {
+            _committedBytes = GC.GetGCMemoryInfo(GCKind.Any).TotalCommittedBytes;
+            _lastCollectionCount = collections;
+        }
+
+        return new ManagedGCStats
+        {
+            HeapSizeBytes = GC.GetTotalMemory(false),
+            CommittedBytes = _committedBytes,
+            TotalAllocatedBytes = GC.GetTotalAllocatedBytes(false),
+            TotalPauseMs = GC.GetTotalPauseDuration().TotalMilliseconds,
+            Gen0Collections = collections - gen1AndUpCollections,
+            Gen1Collections = gen1AndUpCollections - gen2Collections,
+            Gen2Collections = gen2Collections,
+        };
+    }
+}
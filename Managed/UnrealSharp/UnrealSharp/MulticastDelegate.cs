@@ -38,33 +38,97 @@ public abstract class MulticastDelegate<TDelegate> : DelegateBase<TDelegate> whe
 
     public void Add(TDelegate handler)
     {
-        if (handler.Target is not Object targetObject)
+        if (IsUFunctionHandler(handler, out Object? targetObject))
         {
-            throw new ArgumentException("The callback for a multicast delegate must be a valid UFunction defined on a UClass", nameof(handler));
+            FMulticastDelegatePropertyExporter.CallAddDelegate(NativeProperty, NativeDelegate, targetObject!.NativeObject, handler.Method.Name);
+            return;
         }
-        FMulticastDelegatePropertyExporter.CallAddDelegate(NativeProperty, NativeDelegate, targetObject.NativeObject, handler.Method.Name);
+        
+        AddManagedHandler(handler);
     }
 
     public void Remove(TDelegate handler)
     {
-        if (handler.Target is not Object targetObject)
+        if (IsUFunctionHandler(handler, out Object? targetObject))
         {
+            FMulticastDelegatePropertyExporter.CallRemoveDelegate(NativeProperty, NativeDelegate, targetObject!.NativeObject, handler.Method.Name);
             return;
         }
-        FMulticastDelegatePropertyExporter.CallRemoveDelegate(NativeProperty, NativeDelegate, targetObject.NativeObject, handler.Method.Name);
+        
+        IntPtr handlerHandle = FindManagedHandler(handler);
+        
+        if (handlerHandle != IntPtr.Zero)
+        {
+            FMulticastDelegatePropertyExporter.CallRemoveManagedDelegate(NativeProperty, NativeDelegate, handlerHandle);
+        }
     }
 
     public bool Contains(TDelegate handler)
     {
-        if (handler.Target is not Object targetObject)
+        if (IsUFunctionHandler(handler, out Object? targetObject))
         {
-            return false;
+            return FMulticastDelegatePropertyExporter.CallContainsDelegate(NativeProperty, NativeDelegate, targetObject!.NativeObject, handler.Method.Name).ToManagedBool();
         }
-        return FMulticastDelegatePropertyExporter.CallContainsDelegate(NativeProperty, NativeDelegate, targetObject.NativeObject, handler.Method.Name).ToManagedBool();
+        
+        return FindManagedHandler(handler) != IntPtr.Zero;
     }
 
     public void Clear()
     {
-        FMulticastDelegatePropertyExporter.CallClearDelegate(NativeDelegate, NativeProperty);
+        FMulticastDelegatePropertyExporter.CallClearDelegate(NativeProperty, NativeDelegate);
+    }
+    
+    /// <summary>
+    /// Invokes a managed handler with the delegate's native parameter buffer. Generated for each delegate signature.
+    /// </summary>
+    protected virtual void InvokeManagedHandler(TDelegate handler, IntPtr parameters)
+    {
+        throw new NotSupportedException($"{GetType().Name} has no generated managed handler invoker, only UFunctions can be bound to it.");
+    }
+    
+    private static bool IsUFunctionHandler(TDelegate handler, out Object? targetObject)
+    {
+        // Methods exposed to Unreal keep binding by name, so they stay visible to Blueprints and the delegate's owner.
+        targetObject = handler.Target as Object;
+        
+        if (targetObject == null)
+        {
+            return false;
+        }
+        
+        return UClassExporter.CallGetNativeFunctionFromInstanceAndName(targetObject.NativeObject, handler.Method.Name) != IntPtr.Zero;
+    }
+    
+    private void AddManagedHandler(TDelegate handler)
+    {
+        ManagedDelegateHandler.Bind(NativeProperty, NativeDelegate, new BoundHandler(this, handler));
+    }
+    
+    private IntPtr FindManagedHandler(TDelegate handler)
+    {
+        for (int i = 0;; i++)
+        {
+            IntPtr handlerHandle = FMulticastDelegatePropertyExporter.CallGetManagedDelegateHandler(NativeProperty, NativeDelegate, i);
+            
+            if (handlerHandle == IntPtr.Zero)
+            {
+                return IntPtr.Zero;
+            }
+            
+            if (GcHandleUtilities.GetObjectFromHandlePtr(handlerHandle) is ManagedDelegateHandler managedHandler && managedHandler.Handler.Equals(handler))
+            {
+                return handlerHandle;
+            }
+        }
+    }
+    
+    private sealed class BoundHandler(MulticastDelegate<TDelegate> owner, TDelegate handler) : ManagedDelegateHandler
+    {
+        public override Delegate Handler => handler;
+
+        public override void Invoke(IntPtr parameters)
+        {
+            owner.InvokeManagedHandler(handler, parameters);
+        }
     }
-}
\ No newline at end of file
+}
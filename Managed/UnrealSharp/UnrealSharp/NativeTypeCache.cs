@@ -0,0 +1,43 @@
+using System.Collections.Concurrent;
+using UnrealSharp.Interop;
+
+namespace UnrealSharp;
+
+/// <summary>
+/// Native classes looked up by name, so each is only resolved by native once.
+/// Keyed by name rather than type so it doesn't keep reloaded assemblies alive.
+/// </summary>
+internal static unsafe class NativeTypeCache
+{
+    private static readonly ConcurrentDictionary<string, IntPtr> Classes = new();
+
+    // Native bumps this whenever a type may have been replaced by reinstancing or a module reload.
+    private static readonly int* Generation = UCoreUObjectExporter.CallGetTypeCacheGeneration();
+    private static int _cachedGeneration = *Generation;
+
+    public static IntPtr GetClass(string className)
+    {
+        int generation = *Generation;
+
+        if (generation != _cachedGeneration)
+        {
+            Classes.Clear();
+            _cachedGeneration = generation;
+        }
+
+        if (Classes.TryGetValue(className, out IntPtr nativeClass))
+        {
+            return nativeClass;
+        }
+
+        nativeClass = UCoreUObjectExporter.CallGetNativeClassFromName(className);
+
+        // Misses aren't cached, the class may be loaded later.
+        if (nativeClass != IntPtr.Zero)
+        {
+            Classes[className] = nativeClass;
+        }
+
+        return nativeClass;
+    }
+}
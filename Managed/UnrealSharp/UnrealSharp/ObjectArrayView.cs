@@ -0,0 +1,151 @@
+using System.Runtime.CompilerServices;
+using System.Runtime.InteropServices;
+using UnrealSharp.Interop;
+
+namespace UnrealSharp;
+
+[StructLayout(LayoutKind.Sequential)]
+public struct ObjectArrayLayout
+{
+    public int ItemSize;
+    public int SerialNumberOffset;
+    public int FlagsOffset;
+    public int InvalidFlags;
+    public int ElementsPerChunk;
+    public int MaxChunks;
+}
+
+/// <summary>
+/// A read-only view of the engine's global object array, used to resolve weak object pointers without calling into native.
+/// Also remembers which wrapper belongs to which object index, so only the first resolution of an object needs native.
+/// </summary>
+internal static unsafe class ObjectArrayView
+{
+    private static readonly ObjectArrayLayout Layout;
+
+    // Null if the layout couldn't be verified for this engine version, everything then goes through native.
+    private static readonly IntPtr[]? Chunks;
+    private static readonly UnrealSharpObject?[]?[]? Wrappers;
+
+    static ObjectArrayView()
+    {
+        ObjectArrayLayout layout = default;
+
+        if (!FWeakObjectPtrExporter.CallGetObjectArrayLayout(ref layout).ToManagedBool())
+        {
+            return;
+        }
+
+        Layout = layout;
+        Chunks = new IntPtr[layout.MaxChunks];
+        Wrappers = new UnrealSharpObject?[]?[layout.MaxChunks];
+    }
+
+    public static bool IsAvailable => Chunks != null;
+
+    /// <summary>
+    /// Finds the native object a weak object pointer points to, with the same rules as TWeakObjectPtr::Get().
+    /// </summary>
+    [MethodImpl(MethodImplOptions.AggressiveInlining)]
+    public static IntPtr ResolveObject(in WeakObjectData data)
+    {
+        byte* item = FindObjectItem(data.ObjectIndex);
+
+        if (item == null || data.ObjectSerialNumber == 0)
+        {
+            return IntPtr.Zero;
+        }
+
+        if (*(int*) (item + Layout.SerialNumberOffset) != data.ObjectSerialNumber)
+        {
+            return IntPtr.Zero;
+        }
+
+        if ((*(int*) (item + Layout.FlagsOffset) & Layout.InvalidFlags) != 0)
+        {
+            return IntPtr.Zero;
+        }
+
+        // The object pointer is the first member of the item.
+        return *(IntPtr*) item;
+    }
+
+    /// <summary>
+    /// Gets the wrapper that was last resolved for the object at this index, if it still belongs to that object.
+    /// </summary>
+    public static UnrealSharpObject? FindWrapper(int objectIndex, IntPtr nativeObject)
+    {
+        UnrealSharpObject?[]? wrapperChunk = Wrappers![objectIndex / Layout.ElementsPerChunk];
+
+        if (wrapperChunk == null)
+        {
+            return null;
+        }
+
+        UnrealSharpObject? wrapper = wrapperChunk[objectIndex % Layout.ElementsPerChunk];
+
+        // Wrappers are disposed when their object is deleted or their class is reloaded, which clears NativeObject.
+        return wrapper != null && wrapper.NativeObject == nativeObject ? wrapper : null;
+    }
+
+    public static void AddWrapper(int objectIndex, UnrealSharpObject wrapper)
+    {
+        int chunkIndex = objectIndex / Layout.ElementsPerChunk;
+        UnrealSharpObject?[]? wrapperChunk = Wrappers![chunkIndex];
+
+        if (wrapperChunk == null)
+        {
+            Interlocked.CompareExchange(ref Wrappers[chunkIndex], new UnrealSharpObject?[Layout.ElementsPerChunk], null);
+            wrapperChunk = Wrappers[chunkIndex]!;
+        }
+
+        wrapperChunk[objectIndex % Layout.ElementsPerChunk] = wrapper;
+        wrapper.ObjectArrayIndex = objectIndex;
+    }
+
+    public static void RemoveWrapper(UnrealSharpObject wrapper)
+    {
+        int objectIndex = wrapper.ObjectArrayIndex;
+        UnrealSharpObject?[]? wrapperChunk = Wrappers![objectIndex / Layout.ElementsPerChunk];
+
+        if (wrapperChunk == null)
+        {
+            return;
+        }
+
+        // Don't hold on to disposed wrappers, they would keep unloaded assemblies alive after a hot reload.
+        Interlocked.CompareExchange(ref wrapperChunk[objectIndex % Layout.ElementsPerChunk], null, wrapper);
+    }
+
+    private static byte* FindObjectItem(int objectIndex)
+    {
+        if (objectIndex < 0)
+        {
+            return null;
+        }
+
+        int chunkIndex = objectIndex / Layout.ElementsPerChunk;
+
+        if (chunkIndex >= Chunks!.Length)
+        {
+            return null;
+        }
+
+        IntPtr chunk = Chunks[chunkIndex];
+
+        if (chunk == IntPtr.Zero)
+        {
+            // Chunks never move once allocated, so native is only asked once per chunk.
+            chunk = FWeakObjectPtrExporter.CallGetObjectItemChunk(chunkIndex);
+
+            if (chunk == IntPtr.Zero)
+            {
+                return null;
+            }
+
+            Chunks[chunkIndex] = chunk;
+        }
+
+        return (byte*) chunk + (long) (objectIndex % Layout.ElementsPerChunk) * Layout.ItemSize;
+    }
+}
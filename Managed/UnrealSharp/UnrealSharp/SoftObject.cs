@@ -37,7 +37,7 @@ public struct SoftObject<T> where T : Object
     }
     
     /// <summary>
-    /// Loads the object asynchronously.
+    /// Loads the object, blocking the calling thread until it's loaded.
     /// </summary>
     /// <returns></returns>
     public T LoadSynchronous()
@@ -46,6 +46,22 @@ public struct SoftObject<T> where T : Object
         return GcHandleUtilities.GetObjectFromHandlePtr<T>(handle);
     }
     
+    /// <summary>
+    /// Streams the object in without blocking. The task completes on the game thread, with null if the object couldn't be loaded.
+    /// </summary>
+    /// <param name="priority"> The async loading priority. Higher values are loaded first. </param>
+    /// <param name="cancellationToken"> Cancels the load and the task. </param>
+    public Task<T?> LoadAsync(int priority = 0, CancellationToken cancellationToken = default)
+    {
+        return LoadFirstAsync(AsyncLoadRequest<T>.Start(new[] { SoftObjectPtr.PersistentObjectPtrData }, priority, cancellationToken));
+    }
+    
+    private static async Task<T?> LoadFirstAsync(Task<T?[]> loadTask)
+    {
+        T?[] loadedObjects = await loadTask;
+        return loadedObjects[0];
+    }
+    
     private T? Get()
     {
         var foundObject = SoftObjectPtr.Get();
@@ -53,6 +69,22 @@ public struct SoftObject<T> where T : Object
     }
 };
 
+public static class SoftObjectExtensions
+{
+    /// <summary>
+    /// Streams all the objects in as one request without blocking. The task completes on the game thread once every object is loaded,
+    /// with the objects in the same order and null for any that couldn't be loaded.
+    /// </summary>
+    /// <param name="softObjects"> The objects to load. </param>
+    /// <param name="priority"> The async loading priority. Higher values are loaded first. </param>
+    /// <param name="cancellationToken"> Cancels the load and the task. </param>
+    public static Task<T?[]> LoadAsync<T>(this IEnumerable<SoftObject<T>> softObjects, int priority = 0, CancellationToken cancellationToken = default) where T : Object
+    {
+        PersistentObjectPtrData[] softObjectPtrs = softObjects.Select(softObject => softObject.SoftObjectPtr.PersistentObjectPtrData).ToArray();
+        return AsyncLoadRequest<T>.Start(softObjectPtrs, priority, cancellationToken);
+    }
+}
+
 public static class SoftObjectMarshaller<T> where T : Object
 {
     public static void ToNative(IntPtr nativeBuffer, int arrayIndex, SoftObject<T> obj)
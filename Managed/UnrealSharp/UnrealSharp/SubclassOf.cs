@@ -21,7 +21,7 @@ public readonly struct SubclassOf<T>
     public SubclassOf()
     {
         Type type = typeof(T);
-        NativeClass = UCoreUObjectExporter.CallGetNativeClassFromName(type.Name);
+        NativeClass = NativeTypeCache.GetClass(type.Name);
         ManagedType = type;
     }
     
@@ -34,7 +34,7 @@ public readonly struct SubclassOf<T>
         
         if (classType == typeof(T) || classType.IsSubclassOf(typeof(T)))
         {
-            NativeClass = UCoreUObjectExporter.CallGetNativeClassFromName(classType.Name);
+            NativeClass = NativeTypeCache.GetClass(classType.Name);
             ManagedType = classType;
         }
         else
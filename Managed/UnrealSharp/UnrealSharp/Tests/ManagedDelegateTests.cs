@@ -0,0 +1,112 @@
+using System.Reflection;
+using System.Reflection.Emit;
+using System.Runtime.CompilerServices;
+using System.Runtime.InteropServices;
+using System.Runtime.Loader;
+
+namespace UnrealSharp.Tests;
+
+// Matches FCSDelegateUnloadRequest in CSManagedDelegateTargetTests.cpp.
+[StructLayout(LayoutKind.Sequential)]
+internal struct DelegateUnloadRequest
+{
+    public IntPtr DelegateProperty;
+    public IntPtr DelegateAddress;
+    public int Calls;
+    public NativeBool ReloadingEnabled;
+    public NativeBool Collected;
+}
+
+/// <summary>
+/// The managed half of the UnrealSharp.ManagedDelegateTarget automation tests.
+/// Binds a handler declared in a collectible context the way a hot reloaded assembly would, and checks unloading isn't held up by it.
+/// </summary>
+internal static class ManagedDelegateTests
+{
+    private static WeakReference? _context;
+    private static readonly StrongBox<int> Calls = new();
+    
+    private static unsafe void BindInCollectibleContext(object target, IntPtr arguments, IntPtr returnValue)
+    {
+        DelegateUnloadRequest* request = (DelegateUnloadRequest*) arguments;
+        request->ReloadingEnabled = AlcReloadCfg.IsAlcReloadingEnabled.ToNativeBool();
+        
+        if (!AlcReloadCfg.IsAlcReloadingEnabled)
+        {
+            return;
+        }
+        
+        Calls.Value = 0;
+        _context = BindHandler(request->DelegateProperty, request->DelegateAddress);
+    }
+    
+    private static unsafe void UnloadCollectibleContext(object target, IntPtr arguments, IntPtr returnValue)
+    {
+        DelegateUnloadRequest* request = (DelegateUnloadRequest*) arguments;
+        Unload(_context!);
+        
+        for (int i = 0; i < 10 && _context!.IsAlive; i++)
+        {
+            GC.Collect(GC.MaxGeneration, GCCollectionMode.Forced);
+            GC.WaitForPendingFinalizers();
+        }
+        
+        request->Calls = Calls.Value;
+        request->Collected = (!_context!.IsAlive).ToNativeBool();
+        _context = null;
+    }
+    
+    // Kept out of line, so nothing on the caller's stack refers to the context.
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static WeakReference BindHandler(IntPtr nativeProperty, IntPtr nativeDelegate)
+    {
+        AssemblyLoadContext context = new AssemblyLoadContext("UnrealSharpDelegateTest", isCollectible: true);
+        Action<int> handler;
+        
+        // Dynamic assemblies are defined in the contextual reflection context.
+        using (context.EnterContextualReflection())
+        {
+            handler = EmitHandler();
+        }
+        
+        ManagedDelegateHandler.Bind(nativeProperty, nativeDelegate, new TestDelegateHandler(handler));
+        return new WeakReference(context);
+    }
+    
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static void Unload(WeakReference context)
+    {
+        ((AssemblyLoadContext) context.Target!).Unload();
+    }
+    
+    // static void Handle(StrongBox<int> calls, int value) => calls.Value++;
+    private static Action<int> EmitHandler()
+    {
+        AssemblyBuilder assembly = AssemblyBuilder.DefineDynamicAssembly(new AssemblyName("UnrealSharpDelegateTestHandlers"), AssemblyBuilderAccess.RunAndCollect);
+        TypeBuilder type = assembly.DefineDynamicModule("Handlers").DefineType("Handlers", TypeAttributes.Public | TypeAttributes.Abstract | TypeAttributes.Sealed);
+        MethodBuilder method = type.DefineMethod("Handle", MethodAttributes.Public | MethodAttributes.Static, typeof(void), [typeof(StrongBox<int>), typeof(int)]);
+        
+        FieldInfo valueField = typeof(StrongBox<int>).GetField(nameof(StrongBox<int>.Value))!;
+        ILGenerator il = method.GetILGenerator();
+        il.Emit(OpCodes.Ldarg_0);
+        il.Emit(OpCodes.Ldarg_0);
+        il.Emit(OpCodes.Ldfld, valueField);
+        il.Emit(OpCodes.Ldc_I4_1);
+        il.Emit(OpCodes.Add);
+        il.Emit(OpCodes.Stfld, valueField);
+        il.Emit(OpCodes.Ret);
+        
+        MethodInfo handle = type.CreateType().GetMethod("Handle")!;
+        return handle.CreateDelegate<Action<int>>(Calls);
+    }
+    
+    private sealed class TestDelegateHandler(Action<int> handler) : ManagedDelegateHandler
+    {
+        public override Delegate Handler => handler;
+        
+        public override void Invoke(IntPtr parameters)
+        {
+            handler(BlittableMarshaller<int>.FromNative(parameters, 0));
+        }
+    }
+}
@@ -124,6 +124,23 @@ public abstract class UnrealArrayBase<T> : IEnumerable<T>
         return FromNative(NativeArrayBuffer, index);
     }
 
+    /// <summary>
+    /// Gets the native address of the element at the specified index, to read it in place instead of copying it out.
+    /// </summary>
+    /// <param name="index"> The index of the element. </param>
+    /// <param name="elementSize"> The native size of one element. </param>
+    /// <returns> The address of the element. Only valid until the array is resized. </returns>
+    /// <exception cref="IndexOutOfRangeException"> Thrown if the index is out of bounds. </exception>
+    public IntPtr GetElementAddress(int index, int elementSize)
+    {
+        if (index < 0 || index >= Count)
+        {
+            throw new IndexOutOfRangeException($"Index {index} out of bounds. Array is size {Count}");
+        }
+        
+        return NativeArrayBuffer + index * elementSize;
+    }
+
     /// <summary>
     /// Does the array contain the specified element?
     /// </summary>
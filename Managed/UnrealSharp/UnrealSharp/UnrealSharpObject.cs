@@ -35,7 +35,7 @@ public class UnrealObjectDestroyedException : InvalidOperationException
 /// </summary>
 public class UnrealSharpObject : IDisposable
 {
-    internal static IntPtr Create(Type typeToCreate, IntPtr nativeObjectPtr)
+    internal static unsafe IntPtr Create(Type typeToCreate, IntPtr nativeObjectPtr, int* objectFlags)
     {
         unsafe
         {
@@ -43,6 +43,7 @@ public class UnrealSharpObject : IDisposable
             const BindingFlags bindingFlags = BindingFlags.Public | BindingFlags.NonPublic | BindingFlags.Instance;
             var foundConstructor = (delegate*<object, void>) typeToCreate.GetConstructor(bindingFlags, Type.EmptyTypes)!.MethodHandle.GetFunctionPointer();
             createdObject.NativeObject = nativeObjectPtr;
+            createdObject._objectFlags = objectFlags;
             foundConstructor(createdObject);
             return GCHandle.ToIntPtr(GcHandleUtilities.AllocateStrongPointer(createdObject));
         }
@@ -53,6 +54,14 @@ public class UnrealSharpObject : IDisposable
     /// </summary>
     public IntPtr NativeObject { get; private set; }
     
+    // The engine's internal flags for this object, or null if they can't be read directly in this engine version.
+    // Deleted objects are disposed, which clears NativeObject, so the flags are only read while the object is alive.
+    private unsafe int* _objectFlags;
+    
+    private static readonly int GarbageFlag = UObjectExporter.CallGetGarbageFlag();
+    
+    // Where this wrapper is remembered for weak object pointer resolution, or -1 if it hasn't been resolved through one.
+    internal int ObjectArrayIndex = -1;
     
     /// <summary>
     /// The name of the object in Unreal Engine.
@@ -67,7 +76,31 @@ public class UnrealSharpObject : IDisposable
     /// <summary>
     /// Whether the object has been destroyed.
     /// </summary>
-    public bool IsDestroyed => NativeObject == IntPtr.Zero || !UObjectExporter.CallNativeIsValid(NativeObject);
+    public bool IsDestroyed
+    {
+        get
+        {
+            if (NativeObject == IntPtr.Zero)
+            {
+                return true;
+            }
+
+            unsafe
+            {
+                if (_objectFlags != null)
+                {
+                    return (*_objectFlags & GarbageFlag) != 0;
+                }
+            }
+
+            return !UObjectExporter.CallNativeIsValid(NativeObject);
+        }
+    }
+    
+    /// <summary>
+    /// Whether the object is valid, asking the engine directly instead of reading its flags from managed code.
+    /// </summary>
+    public bool IsValidExact => NativeObject != IntPtr.Zero && UObjectExporter.CallNativeIsValid(NativeObject);
 
     /// <inheritdoc />
     public override string ToString()
@@ -177,7 +210,8 @@ public class UnrealSharpObject : IDisposable
     /// <returns> The default object of the specified type. </returns>
     public static T GetDefault<T>() where T : CoreUObject.Object
     {
-        IntPtr handle = UClassExporter.CallGetDefaultFromString(typeof(T).Name);
+        IntPtr nativeClass = NativeTypeCache.GetClass(typeof(T).Name);
+        IntPtr handle = UClassExporter.CallGetDefaultFromInstance(nativeClass);
         return GcHandleUtilities.GetObjectFromHandlePtr<T>(handle)!;
     }
     
@@ -321,7 +355,7 @@ public class UnrealSharpObject : IDisposable
     /// <exception cref="UnrealObjectDestroyedException"> Thrown if the object is not valid. </exception>
     protected void CheckObjectForValidity()
     {
-        if (!UObjectExporter.CallNativeIsValid(NativeObject))
+        if (IsDestroyed)
         {
             throw new UnrealObjectDestroyedException($"{this} is not valid or pending kill.");
         }
@@ -330,6 +364,12 @@ public class UnrealSharpObject : IDisposable
     /// <inheritdoc />
     public virtual void Dispose()
     {
+        if (ObjectArrayIndex >= 0)
+        {
+            ObjectArrayView.RemoveWrapper(this);
+            ObjectArrayIndex = -1;
+        }
+        
         NativeObject = IntPtr.Zero;
         GC.SuppressFinalize(this);
     }
@@ -1,4 +1,5 @@
 ﻿using System.Collections.Concurrent;
+using System.Diagnostics;
 using System.Runtime.InteropServices;
 
 using UnrealSharp.Interop;
@@ -148,10 +149,19 @@ namespace UnrealSharp
         public static UnrealSynchronizationContext GetContext(NamedThread thread)
             => syncContextCache.GetOrAdd(thread, static thread => new(thread));
 
+        // Continuations posted to the game thread. Drained once per frame by the native side, instead of scheduling a task per continuation.
+        private static readonly ConcurrentQueue<(SendOrPostCallback Callback, object? State)> gameThreadQueue = new();
+
         public NamedThread Thread = thread;
 
         public override void Post(SendOrPostCallback d, object? state)
         {
+            if (Thread == NamedThread.GameThread)
+            {
+                gameThreadQueue.Enqueue((d, state));
+                return;
+            }
+            
             RunOnThread(Thread, () => d(state));
         }
 
@@ -163,14 +173,51 @@ namespace UnrealSharp
                 return;
             }
             var semaphore = new ManualResetEventSlim(initialState: false);
-            RunOnThread(Thread, () =>
+            Post(_ =>
             {
                 d(state);
                 semaphore.Set();
-            });
+            }, null);
             semaphore.Wait();
         }
 
+        /// <summary>
+        /// Runs the continuations queued for the game thread, until the queue is empty or the budget is spent.
+        /// Continuations queued while draining wait for the next frame.
+        /// </summary>
+        /// <param name="budgetMs">Time budget in milliseconds, zero or less means no limit. At least one continuation always runs.</param>
+        /// <param name="ranCount">How many continuations ran.</param>
+        /// <returns>How many continuations are still queued.</returns>
+        internal static int RunGameThreadContinuations(float budgetMs, out int ranCount)
+        {
+            ranCount = 0;
+            
+            int queuedCount = gameThreadQueue.Count;
+            long budgetTicks = budgetMs > 0 ? (long)(budgetMs * Stopwatch.Frequency / 1000.0) : long.MaxValue;
+            long startTimestamp = Stopwatch.GetTimestamp();
+
+            while (ranCount < queuedCount && gameThreadQueue.TryDequeue(out var continuation))
+            {
+                try
+                {
+                    continuation.Callback(continuation.State);
+                }
+                catch (Exception ex)
+                {
+                    Console.WriteLine($"Exception in game thread continuation: {ex}");
+                }
+                
+                ranCount++;
+
+                if (Stopwatch.GetTimestamp() - startTimestamp >= budgetTicks)
+                {
+                    break;
+                }
+            }
+
+            return gameThreadQueue.Count;
+        }
+
         public static void RunOnThread(NamedThread thread, Action callback)
         {
             unsafe
@@ -44,6 +44,36 @@ public struct WeakObject<T> : IEquatable<WeakObject<T>> where T : UnrealSharpObj
     }
     
     private T? Get()
+    {
+        if (!ObjectArrayView.IsAvailable)
+        {
+            return GetNative();
+        }
+        
+        IntPtr nativeObject = ObjectArrayView.ResolveObject(Data);
+
+        if (nativeObject == IntPtr.Zero)
+        {
+            return null;
+        }
+
+        if (ObjectArrayView.FindWrapper(Data.ObjectIndex, nativeObject) is T wrapper)
+        {
+            return wrapper;
+        }
+        
+        // First time this object is resolved, let native find or create its wrapper.
+        T? foundObject = GetNative();
+
+        if (foundObject != null)
+        {
+            ObjectArrayView.AddWrapper(Data.ObjectIndex, foundObject);
+        }
+
+        return foundObject;
+    }
+    
+    internal T? GetNative()
     {
         IntPtr handle = FWeakObjectPtrExporter.CallGetObject(Data);
         return GcHandleUtilities.GetObjectFromHandlePtr<T>(handle);
@@ -55,6 +85,11 @@ public struct WeakObject<T> : IEquatable<WeakObject<T>> where T : UnrealSharpObj
     /// <returns>True if the object is valid, false otherwise.</returns>
     public bool IsValid()
     {
+        if (ObjectArrayView.IsAvailable)
+        {
+            return ObjectArrayView.ResolveObject(Data) != IntPtr.Zero;
+        }
+        
         return FWeakObjectPtrExporter.CallIsValid(Data).ToManagedBool();
     }
 
@@ -64,6 +99,12 @@ public struct WeakObject<T> : IEquatable<WeakObject<T>> where T : UnrealSharpObj
     /// <returns>True if the object is stale, false otherwise.</returns>
     public bool IsStale()
     {
+        if (ObjectArrayView.IsAvailable)
+        {
+            // Pointers that were never set aren't stale, everything else that doesn't resolve is.
+            return Data.ObjectSerialNumber != 0 && ObjectArrayView.ResolveObject(Data) == IntPtr.Zero;
+        }
+        
         return FWeakObjectPtrExporter.CallIsStale(Data).ToManagedBool();
     }
 
@@ -93,6 +134,12 @@ public struct WeakObject<T> : IEquatable<WeakObject<T>> where T : UnrealSharpObj
     /// <inheritdoc />
     public bool Equals(WeakObject<T> other)
     {
-        return FWeakObjectPtrExporter.CallNativeEquals(Data, other.Data).ToManagedBool();
+        // Same as FWeakObjectPtr::operator==, pointers that don't resolve are all equal to each other.
+        if (Data.ObjectIndex == other.Data.ObjectIndex && Data.ObjectSerialNumber == other.Data.ObjectSerialNumber)
+        {
+            return true;
+        }
+
+        return !IsValid() && !other.IsValid();
     }
 }
\ No newline at end of file
@@ -0,0 +1,164 @@
+﻿using System.Collections.Concurrent;
+using System.Collections.ObjectModel;
+using System.Diagnostics;
+
+namespace UnrealSharpBuildTool.Actions;
+
+// Long-lived build tool that the editor starts once and sends actions to over stdin, one per line.
+// Keeps the weaver, Mono.Cecil and the bindings assembly loaded between hot reloads, and skips restoring
+// packages when the project files haven't changed since the last successful build.
+// A Cancel line stops the running build, the server itself keeps running.
+public class BuildServer : BuildToolAction
+{
+    public const string ReadyMessage = "UnrealSharpBuildServer:Ready";
+    public const string ActionCompletedPrefix = "UnrealSharpBuildServer:Completed";
+    public const string ExitCommand = "Exit";
+    public const string CancelCommand = "Cancel";
+
+    private DateTime _restoredProjectWriteTime = DateTime.MinValue;
+    
+    private readonly BlockingCollection<string> _commands = new();
+    private readonly object _runningActionLock = new();
+    private CancellationTokenSource? _runningAction;
+    
+    public override bool RunAction()
+    {
+        // Stdin is read on its own thread, so a cancel reaches the action while it runs.
+        Thread commandReader = new Thread(ReadCommands) { IsBackground = true, Name = "BuildServerCommands" };
+        commandReader.Start();
+        
+        // The editor doesn't send anything before it has read this line.
+        Console.WriteLine(ReadyMessage);
+        Console.Out.Flush();
+        
+        foreach (string command in _commands.GetConsumingEnumerable())
+        {
+            if (command == ExitCommand)
+            {
+                break;
+            }
+            
+            using CancellationTokenSource cancellation = new CancellationTokenSource();
+            
+            lock (_runningActionLock)
+            {
+                _runningAction = cancellation;
+            }
+            
+            Stopwatch stopwatch = Stopwatch.StartNew();
+            bool success = RunCommand(command, cancellation.Token) && !cancellation.IsCancellationRequested;
+            stopwatch.Stop();
+            
+            lock (_runningActionLock)
+            {
+                _runningAction = null;
+            }
+            
+            // The editor waits for this line to know the action is done, cancelled or not.
+            Console.WriteLine($"{ActionCompletedPrefix} {(success ? 0 : 1)} {stopwatch.ElapsedMilliseconds}");
+            Console.Out.Flush();
+        }
+
+        return true;
+    }
+
+    private void ReadCommands()
+    {
+        while (Console.In.ReadLine() is { } line)
+        {
+            string command = line.Trim();
+            
+            if (command.Length == 0)
+            {
+                continue;
+            }
+            
+            // Handled here, the main thread is busy with the action it cancels. Ignored if nothing is running.
+            if (command == CancelCommand)
+            {
+                lock (_runningActionLock)
+                {
+                    _runningAction?.Cancel();
+                }
+                
+                continue;
+            }
+            
+            _commands.Add(command);
+        }
+        
+        // The editor closed stdin, which means the same as Exit.
+        _commands.CompleteAdding();
+    }
+
+    private bool RunCommand(string command, CancellationToken cancellationToken)
+    {
+        try
+        {
+            if (!Enum.TryParse(command, out BuildAction action))
+            {
+                throw new Exception($"Unknown build server command \"{command}\"");
+            }
+            
+            return action switch
+            {
+                BuildAction.Build => Build(cancellationToken),
+                BuildAction.Weave => new WeaveProject { WeaveInProcess = true }.RunAction(),
+                _ => throw new Exception($"Build server can't process the \"{action}\" action.")
+            };
+        }
+        catch (Exception exception)
+        {
+            Console.WriteLine(exception.Message);
+            return false;
+        }
+    }
+
+    // Weaving runs in process and is short, so only the build can be cancelled.
+    private bool Build(CancellationToken cancellationToken)
+    {
+        DateTime projectWriteTime = GetProjectFilesWriteTime();
+        bool restoreUpToDate = projectWriteTime == _restoredProjectWriteTime;
+        
+        BuildSolution buildSolution = new BuildSolution
+        {
+            ExtraArguments = restoreUpToDate ? new Collection<string> { "--no-restore" } : null,
+            CancellationToken = cancellationToken
+        };
+
+        if (!buildSolution.RunAction())
+        {
+            // Restore again next time, the failure might have been caused by missing packages. A cancelled build says nothing about them.
+            if (!cancellationToken.IsCancellationRequested)
+            {
+                _restoredProjectWriteTime = DateTime.MinValue;
+            }
+            
+            return false;
+        }
+
+        _restoredProjectWriteTime = projectWriteTime;
+        return true;
+    }
+
+    private static DateTime GetProjectFilesWriteTime()
+    {
+        string scriptFolder = Program.GetScriptFolder();
+        DateTime latestWriteTime = DateTime.MinValue;
+
+        foreach (string pattern in new[] { "*.sln", "*.csproj", "*.props", "*.targets" })
+        {
+            foreach (string file in Directory.EnumerateFiles(scriptFolder, pattern, SearchOption.TopDirectoryOnly))
+            {
+                DateTime writeTime = File.GetLastWriteTimeUtc(file);
+                
+                if (writeTime > latestWriteTime)
+                {
+                    latestWriteTime = writeTime;
+                }
+            }
+        }
+
+        return latestWriteTime;
+    }
+}
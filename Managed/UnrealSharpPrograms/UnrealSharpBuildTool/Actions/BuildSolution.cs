@@ -4,12 +4,17 @@ namespace UnrealSharpBuildTool.Actions;
 
 public class BuildSolution() : BuildToolAction
 {
+    public Collection<string>? ExtraArguments { get; init; }
+    
+    // Stops the build by killing dotnet, used by the build server.
+    public CancellationToken CancellationToken { get; init; }
+    
     public override bool RunAction()
     {
-        return StartBuildingSolution(Program.GetScriptFolder(), Program.buildToolOptions.BuildConfig);
+        return StartBuildingSolution(Program.GetScriptFolder(), Program.buildToolOptions.BuildConfig, ExtraArguments, CancellationToken);
     }
 
-    public static bool StartBuildingSolution(string slnPath, BuildConfig buildConfig, Collection<string>? extraArguments = null)
+    public static bool StartBuildingSolution(string slnPath, BuildConfig buildConfig, Collection<string>? extraArguments = null, CancellationToken cancellationToken = default)
     {
         slnPath = Program.FixPath(slnPath);
         
@@ -42,6 +47,6 @@ public class BuildSolution() : BuildToolAction
             }
         }
 
-        return buildSolutionProcess.StartBuildToolProcess();
+        return buildSolutionProcess.StartBuildToolProcess(cancellationToken);
     }
 }
\ No newline at end of file
@@ -12,6 +12,7 @@ public abstract class BuildToolAction
             BuildAction.Rebuild => new RebuildSolution(),
             BuildAction.Weave => new WeaveProject(),
             BuildAction.Publish => new PublishProject(),
+            BuildAction.BuildServer => new BuildServer(),
             _ => throw new Exception($"Can't find build action with name \"{Program.buildToolOptions.Action}\"")
         };
 
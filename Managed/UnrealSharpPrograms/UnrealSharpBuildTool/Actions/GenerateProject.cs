@@ -264,7 +264,9 @@ public class GenerateProject : BuildToolAction
     {
         Root root = new Root();
 
-        string executablePath = Path.Combine(Program.buildToolOptions.EngineDirectory, "Binaries", "Win64", "UnrealEditor.exe");
+        string executablePath = OperatingSystem.IsWindows()
+            ? Path.Combine(Program.buildToolOptions.EngineDirectory, "Binaries", "Win64", "UnrealEditor.exe")
+            : Path.Combine(Program.buildToolOptions.EngineDirectory, "Binaries", "Linux", "UnrealEditor");
         string commandLineArgs = Program.FixPath(Program.GetUProjectFilePath());
         
         // Create a new profile if it doesn't exist
@@ -2,11 +2,14 @@
 
 public class WeaveProject : BuildToolAction
 {
+    // Weave inside this process instead of spawning the weaver. Used by the build server to keep the weaver warm.
+    public bool WeaveInProcess { get; init; }
+    
     public override bool RunAction()
     {
         var weaverPath = Program.GetWeaver();
         
-        if (!File.Exists(weaverPath))
+        if (!WeaveInProcess && !File.Exists(weaverPath))
         {
             throw new Exception("Couldn't find the weaver");
         }
@@ -15,22 +18,35 @@ public class WeaveProject : BuildToolAction
         var outputPath = Program.GetOutputPath();
         var projectName = Program.GetProjectNameAsManaged();
 
+        List<string> weaverArguments =
+        [
+            // Add path to the compiled binaries.
+            "-p",
+            $"{Program.FixPath(scriptFolderBinaries)}",
+            
+            // Add path to the output folder for the weaver.
+            "-o",
+            $"{Program.FixPath(outputPath)}",
+            
+            // Add the project name.
+            "-n",
+            projectName
+        ];
+
+        if (WeaveInProcess)
+        {
+            UnrealSharpWeaver.WeaverOptions weaverOptions = UnrealSharpWeaver.WeaverOptions.ParseArguments(weaverArguments);
+            return UnrealSharpWeaver.Program.Weave(weaverOptions) == 0;
+        }
+
         BuildToolProcess weaveProcess = new BuildToolProcess();
-        
-        // Add path to the compiled binaries.
         weaveProcess.StartInfo.ArgumentList.Add(weaverPath);
         
-        weaveProcess.StartInfo.ArgumentList.Add("-p");
-        weaveProcess.StartInfo.ArgumentList.Add($"{Program.FixPath(scriptFolderBinaries)}");
-
-        // Add path to the output folder for the weaver.
-        weaveProcess.StartInfo.ArgumentList.Add("-o");
-        weaveProcess.StartInfo.ArgumentList.Add($"{Program.FixPath(outputPath)}");
-
-        // Add the project name.
-        weaveProcess.StartInfo.ArgumentList.Add("-n");
-        weaveProcess.StartInfo.ArgumentList.Add(projectName);
+        foreach (string argument in weaverArguments)
+        {
+            weaveProcess.StartInfo.ArgumentList.Add(argument);
+        }
         
         return weaveProcess.StartBuildToolProcess();
     }
-}
\ No newline at end of file
+}
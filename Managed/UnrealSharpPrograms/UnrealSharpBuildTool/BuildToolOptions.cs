@@ -12,6 +12,7 @@ public enum BuildAction : int
     Rebuild,
     Weave,
     Publish,
+    BuildServer,
 }
 
 public enum BuildConfig : int
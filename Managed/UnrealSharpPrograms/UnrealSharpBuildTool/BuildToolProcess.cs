@@ -18,7 +18,7 @@ public class BuildToolProcess : Process
         StartInfo.CreateNoWindow = true;
     }
 
-    public bool StartBuildToolProcess()
+    public bool StartBuildToolProcess(CancellationToken cancellationToken = default)
     {
         try
         {
@@ -27,6 +27,19 @@ public class BuildToolProcess : Process
                 throw new Exception("Failed to start process");
             }
             
+            // Killing the process ends the reads below, and the non-zero exit code fails the action.
+            using CancellationTokenRegistration cancellation = cancellationToken.Register(() =>
+            {
+                try
+                {
+                    Kill(entireProcessTree: true);
+                }
+                catch (InvalidOperationException)
+                {
+                    // Already exited.
+                }
+            });
+            
             string output = StandardOutput.ReadToEnd();
             string error = StandardError.ReadToEnd();
             
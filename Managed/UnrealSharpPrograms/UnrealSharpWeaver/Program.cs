@@ -1,3 +1,4 @@
+using System.Diagnostics;
 using System.Text.Json;
 using Mono.Cecil;
 using Mono.Cecil.Pdb;
@@ -10,26 +11,36 @@ public static class Program
 {
     public static WeaverOptions WeaverOptions { get; private set; }
     
+    // Kept between runs when the weaver is hosted by a long-lived process, such as the build server.
+    private static AssemblyDefinition? _cachedBindingsAssembly;
+    private static string? _cachedBindingsPath;
+    private static DateTime _cachedBindingsWriteTime;
+    
     public static int Main(string[] args)
     {
-        WeaverOptions = WeaverOptions.ParseArguments(args);
+        return Weave(WeaverOptions.ParseArguments(args));
+    }
 
-        if (!LoadBindingsAssembly())
+    public static int Weave(WeaverOptions weaverOptions)
+    {
+        WeaverOptions = weaverOptions;
+        WeaverPhaseTimer timer = new WeaverPhaseTimer();
+        
+        if (!timer.Measure("Load bindings", LoadBindingsAssembly))
         {
             return 1;
         }
         
-        if (!StartProcessingUserAssembly())
-        {
-            return 2;
-        }
+        bool success = StartProcessingUserAssembly(timer);
+        timer.PrintTimings();
 
-        return 0;
+        return success ? 0 : 2;
     }
 
-    private static bool LoadBindingsAssembly()
+    private static DefaultAssemblyResolver CreateAssemblyResolver()
     {
-        DefaultAssemblyResolver resolver = new DefaultAssemblyResolver();
+        // Read everything into memory, so no file stays locked for the next build while the weaver process lives on.
+        DefaultAssemblyResolver resolver = new InMemoryAssemblyResolver();
         
         foreach (var assemblyPath in WeaverOptions.AssemblyPaths)
         {
@@ -39,10 +50,34 @@ public static class Program
             }
         }
 
+        return resolver;
+    }
+
+    private static bool LoadBindingsAssembly()
+    {
+        string bindingsFileName = WeaverHelper.UnrealSharpNamespace + ".dll";
+        string? bindingsPath = WeaverOptions.AssemblyPaths
+            .Select(assemblyPath => Path.Combine(StripQuotes(assemblyPath), bindingsFileName))
+            .FirstOrDefault(File.Exists);
+        
+        if (_cachedBindingsAssembly != null 
+            && bindingsPath == _cachedBindingsPath 
+            && bindingsPath != null && File.GetLastWriteTimeUtc(bindingsPath) == _cachedBindingsWriteTime)
+        {
+            WeaverHelper.Initialize(_cachedBindingsAssembly);
+            return true;
+        }
+        
+        DefaultAssemblyResolver resolver = CreateAssemblyResolver();
+
         try
         {
             var unrealSharpLibraryAssembly = resolver.Resolve(new AssemblyNameReference(WeaverHelper.UnrealSharpNamespace, new Version(0, 0, 0, 0)));
             WeaverHelper.Initialize(unrealSharpLibraryAssembly);
+
+            _cachedBindingsAssembly = unrealSharpLibraryAssembly;
+            _cachedBindingsPath = bindingsPath;
+            _cachedBindingsWriteTime = bindingsPath != null ? File.GetLastWriteTimeUtc(bindingsPath) : default;
             return true;
         }
         catch
@@ -53,7 +88,7 @@ public static class Program
         return false;
     }
 
-    private static bool StartProcessingUserAssembly()
+    private static bool StartProcessingUserAssembly(WeaverPhaseTimer timer)
     {
         string outputDirectory = StripQuotes(WeaverOptions.OutputDirectory);
         DirectoryInfo outputDirInfo = new DirectoryInfo(outputDirectory);
@@ -73,29 +108,42 @@ public static class Program
             }
 
             string weaverOutputPath = Path.Combine(outputDirectory, Path.GetFileName(userAssemblyPath));
+            
+            // Without a bindings file on disk there's nothing to tell whether the bindings changed, so always weave.
+            string? bindingsPath = _cachedBindingsPath;
+            string? fingerprint = bindingsPath != null 
+                ? timer.Measure("Fingerprint input", () => WeaverInputCache.ComputeFingerprint(userAssemblyPath, bindingsPath)) 
+                : null;
 
-            DefaultAssemblyResolver resolver = new DefaultAssemblyResolver();
-
-            foreach (var assemblyPath in WeaverOptions.AssemblyPaths)
+            if (fingerprint != null && WeaverInputCache.IsUpToDate(weaverOutputPath, fingerprint))
             {
-                if (Directory.Exists(assemblyPath))
-                {
-                    resolver.AddSearchDirectory(assemblyPath);
-                }
+                Console.WriteLine($"{Path.GetFileName(userAssemblyPath)} is unchanged since it was last woven, keeping the previous output.");
+                timer.Measure("Copy dependencies", () => CopyAssemblyDependencies(weaverOutputPath, Path.GetDirectoryName(userAssemblyPath)!));
+                return true;
             }
+            
+            WeaverInputCache.Invalidate(weaverOutputPath);
+
+            using DefaultAssemblyResolver resolver = CreateAssemblyResolver();
 
             var readerParams = new ReaderParameters
             {
                 ReadSymbols = true,
                 SymbolReaderProvider = new PdbReaderProvider(),
-                AssemblyResolver = resolver
+                AssemblyResolver = resolver,
+                InMemory = true,
             };
 
-            AssemblyDefinition userAssembly = AssemblyDefinition.ReadAssembly(userAssemblyPath, readerParams);
+            using AssemblyDefinition userAssembly = timer.Measure("Read assembly", () => AssemblyDefinition.ReadAssembly(userAssemblyPath, readerParams));
 
             try
             {
-                StartWeavingAssembly(userAssembly, weaverOutputPath);
+                StartWeavingAssembly(userAssembly, weaverOutputPath, timer);
+                
+                if (fingerprint != null)
+                {
+                    WeaverInputCache.Save(weaverOutputPath, fingerprint);
+                }
                 return true;
             }
             catch (WeaverProcessError error)
@@ -112,7 +160,7 @@ public static class Program
         return false;
     }
     
-    static void StartWeavingAssembly(AssemblyDefinition assembly, string assemblyOutputPath)
+    static void StartWeavingAssembly(AssemblyDefinition assembly, string assemblyOutputPath, WeaverPhaseTimer timer)
     {
         var assemblyMetaData = new ApiMetaData
         {
@@ -120,16 +168,16 @@ public static class Program
         };
         
         WeaverHelper.ImportCommonTypes(assembly);
-        StartProcessingAssembly(assembly, ref assemblyMetaData);
-        CopyAssemblyDependencies(assemblyOutputPath, Path.GetDirectoryName(assembly.MainModule.FileName)!);
+        StartProcessingAssembly(assembly, ref assemblyMetaData, timer);
+        timer.Measure("Copy dependencies", () => CopyAssemblyDependencies(assemblyOutputPath, Path.GetDirectoryName(assembly.MainModule.FileName)!));
 
         try
         {
-            assembly.Write(assemblyOutputPath, new WriterParameters
+            timer.Measure("Write assembly", () => assembly.Write(assemblyOutputPath, new WriterParameters
             {
                 WriteSymbols = true,
                 SymbolWriterProvider = new PdbWriterProvider(),
-            });
+            }));
         }
         catch (Exception ex)
         {
@@ -137,10 +185,10 @@ public static class Program
             throw;
         }
         
-        WriteAssemblyMetaDataFile(assemblyMetaData, assemblyOutputPath);
+        timer.Measure("Write metadata", () => WriteAssemblyMetaDataFile(assemblyMetaData, assemblyOutputPath));
     }
 
-    static void StartProcessingAssembly(AssemblyDefinition userAssembly, ref ApiMetaData metadata)
+    static void StartProcessingAssembly(AssemblyDefinition userAssembly, ref ApiMetaData metadata, WeaverPhaseTimer timer)
     {
         try
         {
@@ -151,6 +199,8 @@ public static class Program
             List<TypeDefinition> multicastDelegates = [];
             List<TypeDefinition> delegates = [];
             
+            Stopwatch findTypesStopwatch = Stopwatch.StartNew();
+            
             try
             {
                 foreach (var module in userAssembly.Modules)
@@ -189,13 +239,20 @@ public static class Program
                 Console.Error.WriteLine($"Error enumerating types: {ex.Message}");
                 throw;
             }
+
+            timer.AddPhase("Find types", findTypesStopwatch.ElapsedMilliseconds);
             
-            UnrealDelegateProcessor.ProcessMulticastDelegates(multicastDelegates);
-            UnrealDelegateProcessor.ProcessSingleDelegates(delegates);
-            UnrealEnumProcessor.ProcessEnums(enums, metadata);
-            UnrealInterfaceProcessor.ProcessInterfaces(interfaces, metadata);
-            UnrealStructProcessor.ProcessStructs(structs, metadata, userAssembly);
-            UnrealClassProcessor.ProcessClasses(classes, metadata);
+            // The processors mutate the module, which Cecil doesn't support from several threads, so they run in order.
+            ApiMetaData assemblyMetadata = metadata;
+            timer.Measure("Process delegates", () =>
+            {
+                UnrealDelegateProcessor.ProcessMulticastDelegates(multicastDelegates);
+                UnrealDelegateProcessor.ProcessSingleDelegates(delegates);
+            });
+            timer.Measure("Process enums", () => UnrealEnumProcessor.ProcessEnums(enums, assemblyMetadata));
+            timer.Measure("Process interfaces", () => UnrealInterfaceProcessor.ProcessInterfaces(interfaces, assemblyMetadata));
+            timer.Measure("Process structs", () => UnrealStructProcessor.ProcessStructs(structs, assemblyMetadata, userAssembly));
+            timer.Measure("Process classes", () => UnrealClassProcessor.ProcessClasses(classes, assemblyMetadata));
         }
         catch (Exception ex)
         {
@@ -215,15 +272,20 @@ public static class Program
 
         try
         {
-            string[] dependencies = Directory.GetFiles(sourcePath, "*.*");
-            foreach (var dependency in dependencies) 
+            // The woven assembly and its symbols are written by the weaver, never copy the unwoven ones over them.
+            string[] wovenFiles = [Path.GetFileName(destinationPath), Path.GetFileName(Path.ChangeExtension(destinationPath, "pdb"))];
+            string[] dependencies = Directory.GetFiles(sourcePath, "*.*")
+                .Where(dependency => !wovenFiles.Contains(Path.GetFileName(dependency)))
+                .ToArray();
+            
+            Parallel.ForEach(dependencies, dependency =>
             {
                 var destPath = Path.Combine(directoryName, Path.GetFileName(dependency));
                 if (!File.Exists(destPath) || new FileInfo(dependency).LastWriteTimeUtc > new FileInfo(destPath).LastWriteTimeUtc)
                 {
                     File.Copy(dependency, destPath, true);
                 }
-            }
+            });
         }
         catch (Exception ex)
         {
@@ -247,4 +309,13 @@ public static class Program
         string metadataFilePath = Path.ChangeExtension(outputPath, "json");
         File.WriteAllText(metadataFilePath, metaDataContent);
     }
-}
\ No newline at end of file
+}
+
+internal class InMemoryAssemblyResolver : DefaultAssemblyResolver
+{
+    public override AssemblyDefinition Resolve(AssemblyNameReference name, ReaderParameters parameters)
+    {
+        parameters.InMemory = true;
+        return base.Resolve(name, parameters);
+    }
+}
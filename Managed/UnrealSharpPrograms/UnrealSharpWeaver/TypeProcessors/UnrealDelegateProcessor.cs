@@ -23,6 +23,7 @@ public static class UnrealDelegateProcessor
             
             if (invokerMethod.Parameters.Count == 0)
             {
+                WriteManagedHandlerInvoker(type, null);
                 continue;
             }
             
@@ -30,6 +31,7 @@ public static class UnrealDelegateProcessor
             
             WriteInvokerMethod(invokerMethod, functionMetaData);
             ProcessInitialize(type, functionMetaData);
+            WriteManagedHandlerInvoker(type, functionMetaData);
         }
     }
     
@@ -134,6 +136,69 @@ public static class UnrealDelegateProcessor
         WeaverHelper.OptimizeMethod(invokerMethodDefinition);
     }
     
+    // Overrides MulticastDelegate<T>.InvokeManagedHandler, which calls a handler bound through a native delegate target
+    // with the broadcast's parameter buffer. Relies on the param offsets set up for the rewritten Invoker.
+    static void WriteManagedHandlerInvoker(TypeDefinition type, FunctionMetaData? functionMetaData)
+    {
+        TypeReference signatureType = ((GenericInstanceType) type.BaseType).GenericArguments[0];
+        MethodReference signatureInvoke = WeaverHelper.ImportMethod(WeaverHelper.FindMethod(signatureType.Resolve(), "Invoke")!);
+        
+        MethodDefinition invokerFunction = WeaverHelper.AddMethodToType(type, "InvokeManagedHandler", 
+            WeaverHelper.VoidTypeRef, 
+            MethodAttributes.Family | MethodAttributes.Virtual | MethodAttributes.HideBySig, 
+            [WeaverHelper.ImportType(signatureType), WeaverHelper.IntPtrType]);
+        
+        ILProcessor processor = invokerFunction.Body.GetILProcessor();
+        PropertyMetaData[] parameters = functionMetaData?.Parameters ?? [];
+        VariableDefinition[] paramVariables = new VariableDefinition[parameters.Length];
+        Instruction loadBuffer = processor.Create(OpCodes.Ldarg_2);
+        
+        for (int i = 0; i < parameters.Length; ++i)
+        {
+            PropertyMetaData param = parameters[i];
+            paramVariables[i] = WeaverHelper.AddVariableToMethod(invokerFunction, WeaverHelper.ImportType(param.PropertyDataType.CSharpType));
+            
+            if (param.IsOutParameter && !param.IsReferenceParameter)
+            {
+                continue;
+            }
+            
+            FieldDefinition offsetField = functionMetaData!.RewriteInfo.FunctionParams[i].OffsetField!;
+            param.PropertyDataType.WriteLoad(processor, type, loadBuffer, offsetField, paramVariables[i]);
+        }
+        
+        processor.Emit(OpCodes.Ldarg_1);
+        
+        for (int i = 0; i < parameters.Length; ++i)
+        {
+            processor.Emit(parameters[i].IsOutParameter ? OpCodes.Ldloca : OpCodes.Ldloc, paramVariables[i]);
+        }
+        
+        processor.Emit(OpCodes.Callvirt, signatureInvoke);
+        
+        // Marshal out params back to the native parameter buffer.
+        for (int i = 0; i < parameters.Length; ++i)
+        {
+            PropertyMetaData param = parameters[i];
+            
+            if (!param.IsOutParameter)
+            {
+                continue;
+            }
+            
+            FieldDefinition offsetField = functionMetaData!.RewriteInfo.FunctionParams[i].OffsetField!;
+            Instruction[] loadBufferPtr = NativeDataType.GetArgumentBufferInstructions(processor, loadBuffer, offsetField);
+            
+            param.PropertyDataType.WriteMarshalToNative(processor, 
+                type, 
+                loadBufferPtr, 
+                processor.Create(OpCodes.Ldc_I4_0), 
+                processor.Create(OpCodes.Ldloc, paramVariables[i]));
+        }
+        
+        WeaverHelper.FinalizeMethod(invokerFunction);
+    }
+    
     static void ProcessInitialize(TypeDefinition type, FunctionMetaData functionMetaData)
     {
         MethodDefinition initializeDelegate = WeaverHelper.AddMethodToType(type, 
@@ -0,0 +1,79 @@
+﻿using System.Security.Cryptography;
+using System.Text;
+
+namespace UnrealSharpWeaver;
+
+// Remembers what the last successful weave was produced from, next to the woven assembly.
+// Hot reload weaves after every build, and a build often produces the same assembly (deterministic
+// compilation of unchanged code), in which case the previous output can be kept as is.
+// This works on whole assemblies only: any change to the user assembly weaves every type again.
+// Cecil writes whole modules and the compiler emits a new one on every build, so woven types can't be carried over one by one.
+public static class WeaverInputCache
+{
+    private const string CacheFileExtension = "weavercache";
+
+    public static string ComputeFingerprint(string userAssemblyPath, string bindingsPath)
+    {
+        using IncrementalHash hash = IncrementalHash.CreateHash(HashAlgorithmName.SHA256);
+
+        // A new weaver or new bindings can change the output for the same user assembly.
+        AppendFileStamp(hash, typeof(WeaverInputCache).Assembly.Location);
+        AppendFileStamp(hash, bindingsPath);
+        
+        AppendFileContents(hash, userAssemblyPath);
+        AppendFileContents(hash, Path.ChangeExtension(userAssemblyPath, "pdb"));
+
+        return Convert.ToHexString(hash.GetHashAndReset());
+    }
+
+    public static bool IsUpToDate(string weaverOutputPath, string fingerprint)
+    {
+        string cachePath = GetCachePath(weaverOutputPath);
+
+        if (!File.Exists(cachePath) || !File.Exists(weaverOutputPath) || !File.Exists(Path.ChangeExtension(weaverOutputPath, "json")))
+        {
+            return false;
+        }
+
+        return File.ReadAllText(cachePath) == fingerprint;
+    }
+
+    public static void Save(string weaverOutputPath, string fingerprint)
+    {
+        File.WriteAllText(GetCachePath(weaverOutputPath), fingerprint);
+    }
+
+    // Called before the output is overwritten, so a weave that fails halfway is never considered up to date.
+    public static void Invalidate(string weaverOutputPath)
+    {
+        File.Delete(GetCachePath(weaverOutputPath));
+    }
+
+    private static string GetCachePath(string weaverOutputPath)
+    {
+        return Path.ChangeExtension(weaverOutputPath, CacheFileExtension);
+    }
+
+    private static void AppendFileStamp(IncrementalHash hash, string path)
+    {
+        if (!File.Exists(path))
+        {
+            hash.AppendData(Encoding.UTF8.GetBytes("<missing>"));
+            return;
+        }
+        
+        FileInfo fileInfo = new FileInfo(path);
+        hash.AppendData(Encoding.UTF8.GetBytes($"{fileInfo.FullName}|{fileInfo.Length}|{fileInfo.LastWriteTimeUtc.Ticks}"));
+    }
+
+    private static void AppendFileContents(IncrementalHash hash, string path)
+    {
+        if (!File.Exists(path))
+        {
+            hash.AppendData(Encoding.UTF8.GetBytes("<missing>"));
+            return;
+        }
+        
+        hash.AppendData(File.ReadAllBytes(path));
+    }
+}
@@ -0,0 +1,48 @@
+﻿using System.Diagnostics;
+
+namespace UnrealSharpWeaver;
+
+// Measures how long each weaving phase takes, so slow hot reloads can be traced to a phase from the build output.
+public class WeaverPhaseTimer
+{
+    private readonly Stopwatch _totalStopwatch = Stopwatch.StartNew();
+    private readonly List<(string Phase, long Milliseconds)> _phases = [];
+
+    public void Measure(string phase, Action action)
+    {
+        Measure(phase, () =>
+        {
+            action();
+            return true;
+        });
+    }
+
+    public T Measure<T>(string phase, Func<T> action)
+    {
+        Stopwatch stopwatch = Stopwatch.StartNew();
+
+        try
+        {
+            return action();
+        }
+        finally
+        {
+            AddPhase(phase, stopwatch.ElapsedMilliseconds);
+        }
+    }
+
+    public void AddPhase(string phase, long milliseconds)
+    {
+        _phases.Add((phase, milliseconds));
+    }
+
+    public void PrintTimings()
+    {
+        Console.WriteLine($"Weaving took {_totalStopwatch.ElapsedMilliseconds} ms");
+        
+        foreach ((string phase, long milliseconds) in _phases)
+        {
+            Console.WriteLine($"    {phase}: {milliseconds} ms");
+        }
+    }
+}
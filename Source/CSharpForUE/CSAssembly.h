@@ -4,8 +4,8 @@
 
 struct FCSManagedPluginCallbacks
 {
-	using LoadPluginCallback = GCHandleIntPtr(__stdcall*)(const TCHAR*);
-	using UnloadPluginCallback = bool(__stdcall*)(const TCHAR*);
+	using LoadPluginCallback = GCHandleIntPtr(STDCALL*)(const TCHAR*);
+	using UnloadPluginCallback = bool(STDCALL*)(const TCHAR*);
 	
 	LoadPluginCallback LoadPlugin = nullptr;
 	UnloadPluginCallback UnloadPlugin = nullptr;
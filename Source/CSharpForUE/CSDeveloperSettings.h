@@ -18,5 +18,34 @@ public:
 	// Whether Hot Reload should wait for the Editor to gain focus
 	UPROPERTY(EditDefaultsOnly, config, Category = "UnrealSharp | Hot Reload")
 	bool bRequireFocusForHotReload = false;
+
+	// Keep the build tool running between hot reloads, so building and weaving don't pay its startup cost every time.
+	UPROPERTY(EditDefaultsOnly, config, Category = "UnrealSharp | Hot Reload")
+	bool bUseBuildServer = true;
+
+	// Time in milliseconds that async continuations resumed on the game thread may take per frame. The rest waits for the next frame. 0 means no limit.
+	UPROPERTY(EditDefaultsOnly, config, Category = "UnrealSharp | Async", meta = (ClampMin = 0, Units = "ms"))
+	float GameThreadContinuationBudget = 0.0f;
+
+	// Time .NET collections around the engine's GC and level loads, instead of letting the runtime collect whenever it wants.
+	// Read at startup.
+	UPROPERTY(EditDefaultsOnly, config, Category = "UnrealSharp | Garbage Collection", meta = (ConfigRestartRequired = true))
+	bool bCoordinateManagedGC = false;
+
+	// Run the .NET GC in SustainedLowLatency mode, which avoids blocking gen2 collections while memory is available.
+	UPROPERTY(EditDefaultsOnly, config, Category = "UnrealSharp | Garbage Collection", meta = (EditCondition = "bCoordinateManagedGC", ConfigRestartRequired = true))
+	bool bUseSustainedLowLatency = true;
+
+	// Managed memory in megabytes that may be allocated while the engine collects garbage without starting a .NET collection. 0 doesn't suppress collections.
+	UPROPERTY(EditDefaultsOnly, config, Category = "UnrealSharp | Garbage Collection", meta = (EditCondition = "bCoordinateManagedGC", ClampMin = 0, Units = "MB"))
+	int32 NoGCRegionSize = 16;
+
+	// The .NET generation collected right after the engine's GC, when the wrappers of deleted objects have just been released.
+	UPROPERTY(EditDefaultsOnly, config, Category = "UnrealSharp | Garbage Collection", meta = (EditCondition = "bCoordinateManagedGC", ClampMin = 0, ClampMax = 1))
+	int32 PostEngineGCGeneration = 1;
+
+	// Run a full compacting .NET collection once a level has loaded, while a hitch goes unnoticed.
+	UPROPERTY(EditDefaultsOnly, config, Category = "UnrealSharp | Garbage Collection", meta = (EditCondition = "bCoordinateManagedGC"))
+	bool bFullCollectionAfterLevelLoad = true;
 	
 };
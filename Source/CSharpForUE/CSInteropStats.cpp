@@ -0,0 +1,168 @@
+﻿#include "CSInteropStats.h"
+
+#if WITH_CSHARP_INTEROP_STATS
+
+#include "CSharpForUE.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "UObject/UObjectGlobals.h"
+
+namespace
+{
+	FCriticalSection StatsLock;
+	TMap<FString, TUniquePtr<FCSInteropCallStats>> StatsByName;
+	// Only a cache in front of StatsByName. Reloading replaces functions, and their addresses get reused, so it's cleared on reload.
+	TMap<const UFunction*, FCSInteropCallStats*> StatsByFunction;
+	FDelegateHandle ReloadCompleteHandle;
+	uint64 ResetFrame = 0;
+	
+	FAutoConsoleCommand DumpInteropStatsCommand(
+		TEXT("UnrealSharp.InteropStats.Dump"),
+		TEXT("Writes the call count and time of every interop entry point to a CSV file. Optionally takes the file path. Requires -UnrealSharpInteropStats."),
+		FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+		{
+			const FString FilePath = Args.Num() > 0 ? Args[0] : FPaths::ProfilingDir() / FString::Printf(TEXT("UnrealSharpInteropStats-%s.csv"), *FDateTime::Now().ToString());
+			FCSInteropStats::DumpToCsv(FilePath);
+		}));
+
+	FAutoConsoleCommand ResetInteropStatsCommand(
+		TEXT("UnrealSharp.InteropStats.Reset"),
+		TEXT("Resets the interop call counts and times."),
+		FConsoleCommandDelegate::CreateStatic(&FCSInteropStats::Reset));
+}
+
+bool FCSInteropStats::IsEnabled()
+{
+	static const bool bEnabled = FParse::Param(FCommandLine::Get(), TEXT("UnrealSharpInteropStats"));
+	return bEnabled;
+}
+
+FCSInteropCallStats& FCSInteropStats::FindOrAdd(const FString& Name)
+{
+	FScopeLock Lock(&StatsLock);
+	
+	if (TUniquePtr<FCSInteropCallStats>* FoundStats = StatsByName.Find(Name))
+	{
+		return **FoundStats;
+	}
+
+	TUniquePtr<FCSInteropCallStats>& NewStats = StatsByName.Add(Name, MakeUnique<FCSInteropCallStats>());
+	NewStats->Name = Name;
+	
+#if STATS
+	NewStats->StatId = FDynamicStats::CreateStatId<FStatGroup_STATGROUP_UnrealSharp>(Name);
+#endif
+
+	return *NewStats;
+}
+
+FCSInteropCallStats& FCSInteropStats::FindOrAdd(const UFunction* ManagedFunction)
+{
+	{
+		FScopeLock Lock(&StatsLock);
+		
+		if (FCSInteropCallStats** FoundStats = StatsByFunction.Find(ManagedFunction))
+		{
+			return **FoundStats;
+		}
+	}
+
+	FCSInteropCallStats& Stats = FindOrAdd(TEXT("Managed.") + ManagedFunction->GetOwnerClass()->GetName() + TEXT(".") + ManagedFunction->GetName());
+	
+	FScopeLock Lock(&StatsLock);
+	
+	if (!ReloadCompleteHandle.IsValid())
+	{
+		ReloadCompleteHandle = FCoreUObjectDelegates::ReloadCompleteDelegate.AddLambda([](EReloadCompleteReason)
+		{
+			FScopeLock ReloadLock(&StatsLock);
+			StatsByFunction.Empty();
+		});
+	}
+	
+	StatsByFunction.Add(ManagedFunction, &Stats);
+	return Stats;
+}
+
+void FCSInteropStats::Shutdown()
+{
+	FScopeLock Lock(&StatsLock);
+	
+	FCoreUObjectDelegates::ReloadCompleteDelegate.Remove(ReloadCompleteHandle);
+	ReloadCompleteHandle.Reset();
+	StatsByFunction.Empty();
+}
+
+void FCSInteropStats::Reset()
+{
+	FScopeLock Lock(&StatsLock);
+	
+	for (const TPair<FString, TUniquePtr<FCSInteropCallStats>>& Stats : StatsByName)
+	{
+		Stats.Value->Calls = 0;
+		Stats.Value->Cycles = 0;
+	}
+
+	ResetFrame = GFrameCounter;
+}
+
+bool FCSInteropStats::DumpToCsv(const FString& FilePath)
+{
+	if (!IsEnabled())
+	{
+		UE_LOG(LogUnrealSharp, Warning, TEXT("Interop stats are only collected when started with -UnrealSharpInteropStats."));
+		return false;
+	}
+	
+	struct FRow
+	{
+		const FString* Name;
+		uint64 Calls;
+		uint64 Cycles;
+	};
+	
+	TArray<FRow> Rows;
+	{
+		FScopeLock Lock(&StatsLock);
+		Rows.Reserve(StatsByName.Num());
+		
+		for (const TPair<FString, TUniquePtr<FCSInteropCallStats>>& Stats : StatsByName)
+		{
+			const uint64 Calls = Stats.Value->Calls.load(std::memory_order_relaxed);
+			
+			if (Calls > 0)
+			{
+				Rows.Add({ &Stats.Key, Calls, Stats.Value->Cycles.load(std::memory_order_relaxed) });
+			}
+		}
+	}
+
+	Rows.Sort([](const FRow& A, const FRow& B)
+	{
+		return A.Cycles > B.Cycles;
+	});
+
+	const double Frames = FMath::Max<double>(1.0, GFrameCounter - ResetFrame);
+	
+	TArray<FString> Lines;
+	Lines.Reserve(Rows.Num() + 1);
+	Lines.Add(TEXT("Function,Calls,CallsPerFrame,TotalMs,MsPerFrame,AverageUs"));
+	
+	for (const FRow& Row : Rows)
+	{
+		const double TotalMs = FPlatformTime::ToMilliseconds64(Row.Cycles);
+		Lines.Add(FString::Printf(TEXT("%s,%llu,%.2f,%.3f,%.4f,%.3f"), **Row.Name, Row.Calls, Row.Calls / Frames, TotalMs, TotalMs / Frames, TotalMs * 1000.0 / Row.Calls));
+	}
+
+	if (!FFileHelper::SaveStringArrayToFile(Lines, *FilePath))
+	{
+		UE_LOG(LogUnrealSharp, Warning, TEXT("Couldn't write interop stats to '%s'"), *FilePath);
+		return false;
+	}
+
+	UE_LOG(LogUnrealSharp, Display, TEXT("Wrote interop stats for %d functions over %.0f frames to '%s'"), Rows.Num(), Frames, *FilePath);
+	return true;
+}
+
+#endif
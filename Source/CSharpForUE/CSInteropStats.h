@@ -0,0 +1,93 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include <atomic>
+
+// Per function call counts and timings for the interop boundary. Compiled out of Shipping builds,
+// and even when compiled in nothing is wrapped unless the process is started with -UnrealSharpInteropStats.
+#ifndef WITH_CSHARP_INTEROP_STATS
+#define WITH_CSHARP_INTEROP_STATS !UE_BUILD_SHIPPING
+#endif
+
+#if WITH_CSHARP_INTEROP_STATS
+
+// Calls and time spent in one interop entry point since the last reset.
+struct FCSInteropCallStats
+{
+	FString Name;
+	std::atomic<uint64> Calls = 0;
+	std::atomic<uint64> Cycles = 0;
+	TStatId StatId;
+};
+
+class CSHARPFORUE_API FCSInteropStats
+{
+public:
+
+	// Decided once, since the exported functions are only handed to managed code once.
+	static bool IsEnabled();
+
+	static FCSInteropCallStats& FindOrAdd(const FString& Name);
+	static FCSInteropCallStats& FindOrAdd(const UFunction* ManagedFunction);
+
+	static void Reset();
+	static void Shutdown();
+
+	// Writes every entry point that has been called since the last reset, most expensive first.
+	static bool DumpToCsv(const FString& FilePath);
+	
+};
+
+// Counts one call and times it, both into the totals and into "stat unrealsharp".
+struct FCSScopedInteropCall
+{
+	explicit FCSScopedInteropCall(FCSInteropCallStats& InStats)
+		: Stats(InStats)
+		, CycleCounter(InStats.StatId)
+		, StartCycles(FPlatformTime::Cycles64())
+	{
+	}
+
+	~FCSScopedInteropCall()
+	{
+		Stats.Calls.fetch_add(1, std::memory_order_relaxed);
+		Stats.Cycles.fetch_add(FPlatformTime::Cycles64() - StartCycles, std::memory_order_relaxed);
+	}
+
+private:
+	
+	FCSInteropCallStats& Stats;
+	FScopeCycleCounter CycleCounter;
+	uint64 StartCycles;
+};
+
+template<auto Function>
+struct TCSInstrumentedExport;
+
+// Shim with the same signature as the exported function, handed to managed code in its place.
+template<typename ReturnType, typename... ArgTypes, ReturnType(*Function)(ArgTypes...)>
+struct TCSInstrumentedExport<Function>
+{
+	static inline FCSInteropCallStats* Stats = nullptr;
+	
+	static ReturnType Invoke(ArgTypes... Args)
+	{
+		FCSScopedInteropCall InteropCall(*Stats);
+		return Function(Args...);
+	}
+};
+
+template<auto Function>
+void* GetExportedFunctionPointer(const FString& Name)
+{
+	if (!FCSInteropStats::IsEnabled())
+	{
+		return reinterpret_cast<void*>(Function);
+	}
+	
+	TCSInstrumentedExport<Function>::Stats = &FCSInteropStats::FindOrAdd(Name);
+	return reinterpret_cast<void*>(&TCSInstrumentedExport<Function>::Invoke);
+}
+
+#endif
@@ -3,6 +3,8 @@
 struct FInvokeManagedMethodData;
 struct GCHandleIntPtr;
 struct FGCHandle;
+struct FCSManagedGCStats;
+struct FCSManagedGCSettings;
 
 class CSHARPFORUE_API FCSManagedCallbacks
 {
@@ -10,18 +12,26 @@ class CSHARPFORUE_API FCSManagedCallbacks
 
 	struct FManagedCallbacks
 	{
-		using ManagedCallbacks_CreateNewManagedObject = GCHandleIntPtr(__stdcall*)(void*, void*);
-		using ManagedCallbacks_InvokeManagedEvent = int(__stdcall*)(GCHandleIntPtr, void*, void*, void*, void*);
-		using ManagedCallbacks_InvokeDelegate = int(__stdcall*)(GCHandleIntPtr);
-		using ManagedCallbacks_LookupMethod = void*(__stdcall*)(void*, const TCHAR*);
-		using ManagedCallbacks_LookupType = uint8*(__stdcall*)(GCHandleIntPtr, const TCHAR*, const TCHAR*);
-		using ManagedCallbacks_Dispose = void(__stdcall*)(GCHandleIntPtr);
+		using ManagedCallbacks_CreateNewManagedObject = GCHandleIntPtr(STDCALL*)(void*, void*, const int32*);
+		using ManagedCallbacks_InvokeManagedEvent = int(STDCALL*)(GCHandleIntPtr, void*, void*, void*, void*);
+		using ManagedCallbacks_InvokeDelegate = int(STDCALL*)(GCHandleIntPtr);
+		using ManagedCallbacks_LookupMethod = void*(STDCALL*)(void*, const TCHAR*);
+		using ManagedCallbacks_LookupType = uint8*(STDCALL*)(GCHandleIntPtr, const TCHAR*, const TCHAR*);
+		using ManagedCallbacks_RunGameThreadContinuations = int32(STDCALL*)(float, int32*);
+		using ManagedCallbacks_InvokeTimerCallbacks = int32(STDCALL*)(const GCHandleIntPtr*, int32, FString*);
+		using ManagedCallbacks_GetGCStats = void(STDCALL*)(FCSManagedGCStats*);
+		using ManagedCallbacks_CoordinateGC = void(STDCALL*)(int32, const FCSManagedGCSettings*);
+		using ManagedCallbacks_Dispose = void(STDCALL*)(GCHandleIntPtr);
 		
 		ManagedCallbacks_CreateNewManagedObject CreateNewManagedObject;
 		ManagedCallbacks_InvokeManagedEvent InvokeManagedMethod;
 		ManagedCallbacks_InvokeDelegate InvokeDelegate;
 		ManagedCallbacks_LookupMethod LookupManagedMethod;
 		ManagedCallbacks_LookupType LookupManagedType;
+		ManagedCallbacks_RunGameThreadContinuations RunGameThreadContinuations;
+		ManagedCallbacks_InvokeTimerCallbacks InvokeTimerCallbacks;
+		ManagedCallbacks_GetGCStats GetGCStats;
+		ManagedCallbacks_CoordinateGC CoordinateGC;
 
 	private:
 		
@@ -0,0 +1,109 @@
+﻿#include "CSManagedDelegateTarget.h"
+#include "CSDeveloperSettings.h"
+#include "CSharpForUE.h"
+#include "CSManagedStats.h"
+#include "UObject/Package.h"
+
+#if ENGINE_MINOR_VERSION >= 4
+#include "Blueprint/BlueprintExceptionInfo.h"
+#endif
+
+TSet<UCSManagedDelegateTarget*> UCSManagedDelegateTarget::LiveTargets;
+
+UCSManagedDelegateTarget* UCSManagedDelegateTarget::Create(UObject* Owner, GCHandleIntPtr Handler, FInvokeManagedHandler Invoker, UFunction* SignatureFunction)
+{
+	static bool bRegisteredCleanup = false;
+	if (!bRegisteredCleanup)
+	{
+		FCoreUObjectDelegates::GetPostGarbageCollect().AddStatic(&UCSManagedDelegateTarget::ReleaseStaleTargets);
+		bRegisteredCleanup = true;
+	}
+
+	UCSManagedDelegateTarget* Target = NewObject<UCSManagedDelegateTarget>(GetTransientPackage(), NAME_None, RF_Transient);
+	Target->Handler = FGCHandle(Handler);
+	Target->Handler.Type = GCHandleType::StrongHandle;
+	Target->Invoker = Invoker;
+	Target->SignatureFunction = SignatureFunction;
+	Target->Owner = Owner;
+	Target->bHasOwner = Owner != nullptr;
+	Target->AddToRoot();
+
+	LiveTargets.Add(Target);
+	return Target;
+}
+
+void UCSManagedDelegateTarget::Release()
+{
+	if (!LiveTargets.Remove(this))
+	{
+		return;
+	}
+
+	Handler.Dispose();
+	Invoker = nullptr;
+	RemoveFromRoot();
+}
+
+void UCSManagedDelegateTarget::Invoke()
+{
+	// Only ever called through ProcessEvent, which doesn't run the thunk for it.
+	checkNoEntry();
+}
+
+void UCSManagedDelegateTarget::ProcessEvent(UFunction* Function, void* Parms)
+{
+	if (Function->GetFName() != GetInvokeFunctionName())
+	{
+		Super::ProcessEvent(Function, Parms);
+		return;
+	}
+
+	// Released while a broadcast was in flight.
+	if (!Invoker)
+	{
+		return;
+	}
+
+	// A native function's frame only gets a copy of its own parameters, and Invoke has none.
+	// The broadcast's buffer is only available here, laid out for the delegate's signature.
+	// Out parameters are written straight into it, so the broadcaster sees them without copying back.
+	if (!SignatureFunction || (!Parms && SignatureFunction->ParmsSize > 0))
+	{
+		UE_LOG(LogUnrealSharp, Error, TEXT("%s was broadcast without the parameters of its delegate signature."), *GetName());
+		return;
+	}
+
+#if WITH_CSHARP_MANAGED_STATS
+	FCSScopedManagedTime ManagedTime;
+#endif
+
+	FString ExceptionMessage;
+	if (Invoker(Handler.GetHandle(), Parms, &ExceptionMessage) == 0)
+	{
+		return;
+	}
+
+	const UCSDeveloperSettings* Settings = GetDefault<UCSDeveloperSettings>();
+	EBlueprintExceptionType::Type ExceptionType = Settings->bCrashOnException ? EBlueprintExceptionType::FatalError : EBlueprintExceptionType::NonFatalError;
+
+	FFrame Stack(this, SignatureFunction, Parms, nullptr, SignatureFunction->ChildProperties);
+	const FBlueprintExceptionInfo ExceptionInfo(ExceptionType, FText::FromString(ExceptionMessage));
+	FBlueprintCoreDelegates::ThrowScriptException(this, Stack, ExceptionInfo);
+}
+
+void UCSManagedDelegateTarget::ReleaseStaleTargets()
+{
+	TArray<UCSManagedDelegateTarget*> StaleTargets;
+	for (UCSManagedDelegateTarget* Target : LiveTargets)
+	{
+		if (Target->bHasOwner && !Target->Owner.IsValid())
+		{
+			StaleTargets.Add(Target);
+		}
+	}
+
+	for (UCSManagedDelegateTarget* Target : StaleTargets)
+	{
+		Target->Release();
+	}
+}
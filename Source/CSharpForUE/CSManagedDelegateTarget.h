@@ -0,0 +1,54 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "CSManagedGCHandle.h"
+#include "CSManagedDelegateTarget.generated.h"
+
+// Stands in as the bound object when a multicast delegate is bound to a managed handler (lambdas, non-UFunction methods).
+// Broadcasts reach it through ProcessEvent, which hands the delegate's parameter buffer straight to the managed handler.
+UCLASS(Transient, meta = (NotGeneratorValid))
+class CSHARPFORUE_API UCSManagedDelegateTarget : public UObject
+{
+	GENERATED_BODY()
+
+public:
+
+	// Returns non-zero and fills the exception message if the handler threw.
+	using FInvokeManagedHandler = int32(STDCALL*)(GCHandleIntPtr, void*, FString*);
+
+	static UCSManagedDelegateTarget* Create(UObject* Owner, GCHandleIntPtr Handler, FInvokeManagedHandler Invoker, UFunction* SignatureFunction);
+
+	static FName GetInvokeFunctionName() { return GET_FUNCTION_NAME_CHECKED(UCSManagedDelegateTarget, Invoke); }
+
+	const FGCHandle& GetHandler() const { return Handler; }
+
+	// Frees the managed handler and lets the target be garbage collected. The caller removes it from the delegate.
+	void Release();
+
+	// Begin UObject interface
+	virtual void ProcessEvent(UFunction* Function, void* Parms) override;
+	// End UObject interface
+
+private:
+
+	// Only bound by name, broadcasts are handled in ProcessEvent.
+	UFUNCTION()
+	void Invoke();
+
+	static void ReleaseStaleTargets();
+
+	FGCHandle Handler;
+	FInvokeManagedHandler Invoker = nullptr;
+
+	// The signature of the delegate the target is bound to, which the broadcast's parameter buffer is laid out for.
+	UPROPERTY()
+	TObjectPtr<UFunction> SignatureFunction;
+
+	// The object that owns the delegate, if known. The target is released once it's gone.
+	TWeakObjectPtr<UObject> Owner;
+	bool bHasOwner = false;
+
+	// Targets are rooted while bound, since delegates only hold weak references to their objects.
+	static TSet<UCSManagedDelegateTarget*> LiveTargets;
+	
+};
@@ -0,0 +1,94 @@
+﻿#include "CSManagedGCCoordinator.h"
+#include "CSharpForUE.h"
+#include "CSDeveloperSettings.h"
+#include "CSManagedCallbacksCache.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+#include "UObject/UObjectGlobals.h"
+
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("Managed GC Pause In Last Engine GC (ms)"), STAT_UnrealSharp_ManagedPauseInEngineGC, STATGROUP_UnrealSharp);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Managed Gen2 Collections In Engine GC"), STAT_UnrealSharp_Gen2CollectionsInEngineGC, STATGROUP_UnrealSharp);
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("Coordinated Managed Collection (ms)"), STAT_UnrealSharp_CoordinatedCollection, STATGROUP_UnrealSharp);
+
+void FCSManagedGCCoordinator::Initialize()
+{
+	const UCSDeveloperSettings* DeveloperSettings = GetDefault<UCSDeveloperSettings>();
+	bCoordinate = DeveloperSettings->bCoordinateManagedGC;
+	
+	Settings.NoGCRegionBytes = static_cast<int64>(DeveloperSettings->NoGCRegionSize) * 1024 * 1024;
+	Settings.PostEngineGCGeneration = DeveloperSettings->PostEngineGCGeneration;
+	Settings.bSustainedLowLatency = DeveloperSettings->bUseSustainedLowLatency;
+	Settings.bFullCollectionAfterLevelLoad = DeveloperSettings->bFullCollectionAfterLevelLoad;
+
+	PreGarbageCollectHandle = FCoreUObjectDelegates::GetPreGarbageCollectDelegate().AddStatic(&FCSManagedGCCoordinator::OnPreGarbageCollect);
+	PostGarbageCollectHandle = FCoreUObjectDelegates::GetPostGarbageCollect().AddStatic(&FCSManagedGCCoordinator::OnPostGarbageCollect);
+
+	if (!bCoordinate)
+	{
+		return;
+	}
+	
+	PostLoadMapHandle = FCoreUObjectDelegates::PostLoadMapWithWorld.AddStatic(&FCSManagedGCCoordinator::OnPostLoadMap);
+	SendEvent(ECSManagedGCEvent::Initialize);
+}
+
+void FCSManagedGCCoordinator::Shutdown()
+{
+	FCoreUObjectDelegates::GetPreGarbageCollectDelegate().Remove(PreGarbageCollectHandle);
+	FCoreUObjectDelegates::GetPostGarbageCollect().Remove(PostGarbageCollectHandle);
+	FCoreUObjectDelegates::PostLoadMapWithWorld.Remove(PostLoadMapHandle);
+
+	PreGarbageCollectHandle.Reset();
+	PostGarbageCollectHandle.Reset();
+	PostLoadMapHandle.Reset();
+}
+
+void FCSManagedGCCoordinator::OnPreGarbageCollect()
+{
+	FCSManagedCallbacks::ManagedCallbacks.GetGCStats(&StatsBeforeEngineGC);
+
+	if (bCoordinate)
+	{
+		SendEvent(ECSManagedGCEvent::PreEngineGC);
+	}
+}
+
+void FCSManagedGCCoordinator::OnPostGarbageCollect()
+{
+	FCSManagedGCStats StatsAfterEngineGC;
+	FCSManagedCallbacks::ManagedCallbacks.GetGCStats(&StatsAfterEngineGC);
+
+	const float PauseMs = StatsAfterEngineGC.TotalPauseMs - StatsBeforeEngineGC.TotalPauseMs;
+	const int32 Gen2Collections = StatsAfterEngineGC.Gen2Collections - StatsBeforeEngineGC.Gen2Collections;
+
+	SET_FLOAT_STAT(STAT_UnrealSharp_ManagedPauseInEngineGC, PauseMs);
+	INC_DWORD_STAT_BY(STAT_UnrealSharp_Gen2CollectionsInEngineGC, Gen2Collections);
+	CSV_CUSTOM_STAT(UnrealSharp, ManagedGCPauseInEngineGCMs, PauseMs, ECsvCustomStatOp::Set);
+
+	if (Gen2Collections > 0)
+	{
+		UE_LOG(LogUnrealSharp, Log, TEXT("A gen2 .NET collection ran during the engine's GC, pausing managed code for %.2f ms."), PauseMs);
+	}
+
+	if (!bCoordinate)
+	{
+		return;
+	}
+
+	// The collection moved out of the engine's GC, timed on its own.
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+	SendEvent(ECSManagedGCEvent::PostEngineGC);
+	
+	const float CollectionMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles);
+	SET_FLOAT_STAT(STAT_UnrealSharp_CoordinatedCollection, CollectionMs);
+	CSV_CUSTOM_STAT(UnrealSharp, CoordinatedManagedCollectionMs, CollectionMs, ECsvCustomStatOp::Set);
+}
+
+void FCSManagedGCCoordinator::OnPostLoadMap(UWorld* World)
+{
+	SendEvent(ECSManagedGCEvent::LevelLoaded);
+}
+
+void FCSManagedGCCoordinator::SendEvent(ECSManagedGCEvent Event)
+{
+	FCSManagedCallbacks::ManagedCallbacks.CoordinateGC(static_cast<int32>(Event), &Settings);
+}
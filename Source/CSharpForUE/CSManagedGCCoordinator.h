@@ -0,0 +1,50 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "CSManagedStats.h"
+
+// Matches ManagedGCEvent in ManagedGCCoordinator.cs.
+enum class ECSManagedGCEvent : int32
+{
+	Initialize,
+	PreEngineGC,
+	PostEngineGC,
+	LevelLoaded,
+};
+
+// Matches ManagedGCSettings in ManagedGCCoordinator.cs.
+struct FCSManagedGCSettings
+{
+	int64 NoGCRegionBytes = 0;
+	int32 PostEngineGCGeneration = 1;
+	bool bSustainedLowLatency = false;
+	bool bFullCollectionAfterLevelLoad = false;
+};
+
+// Keeps .NET collections out of the engine's GC, where the two pauses would add up to one long frame.
+// With bCoordinateManagedGC, managed allocations don't start a collection while the engine collects,
+// the ephemeral generations are collected right after it instead, and a full collection runs once a level has loaded.
+// How much managed GC pause lands inside the engine's GC is measured either way, to compare with and without.
+class CSHARPFORUE_API FCSManagedGCCoordinator
+{
+public:
+
+	static void Initialize();
+	static void Shutdown();
+
+private:
+
+	static void OnPreGarbageCollect();
+	static void OnPostGarbageCollect();
+	static void OnPostLoadMap(UWorld* World);
+
+	static void SendEvent(ECSManagedGCEvent Event);
+
+	static inline bool bCoordinate = false;
+	static inline FCSManagedGCSettings Settings;
+	static inline FCSManagedGCStats StatsBeforeEngineGC;
+
+	static inline FDelegateHandle PreGarbageCollectHandle;
+	static inline FDelegateHandle PostGarbageCollectHandle;
+	static inline FDelegateHandle PostLoadMapHandle;
+};
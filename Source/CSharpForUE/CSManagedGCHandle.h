@@ -55,3 +55,22 @@ struct FGCHandle
 	}
 };
 
+// Owns a strong handle to a managed object and frees it when destroyed.
+// Native delegates share one of these to keep a managed callback alive for as long as they're bound.
+struct FScopedGCHandle
+{
+	FGCHandle Handle;
+
+	explicit FScopedGCHandle(GCHandleIntPtr InHandle) : Handle(InHandle)
+	{
+		Handle.Type = GCHandleType::StrongHandle;
+	}
+
+	FScopedGCHandle(const FScopedGCHandle&) = delete;
+	FScopedGCHandle& operator = (const FScopedGCHandle&) = delete;
+
+	~FScopedGCHandle()
+	{
+		Handle.Dispose();
+	}
+};
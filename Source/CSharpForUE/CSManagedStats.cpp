@@ -0,0 +1,72 @@
+﻿#include "CSManagedStats.h"
+
+#if WITH_CSHARP_MANAGED_STATS
+
+#include "CSharpForUE.h"
+#include "CSManagedCallbacksCache.h"
+
+DECLARE_MEMORY_STAT(TEXT("Managed Heap Size"), STAT_UnrealSharp_ManagedHeapSize, STATGROUP_UnrealSharp);
+DECLARE_MEMORY_STAT(TEXT("Managed Committed Memory"), STAT_UnrealSharp_ManagedCommittedMemory, STATGROUP_UnrealSharp);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Managed Allocations (KB)"), STAT_UnrealSharp_ManagedAllocations, STATGROUP_UnrealSharp);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Managed Gen0 Collections"), STAT_UnrealSharp_Gen0Collections, STATGROUP_UnrealSharp);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Managed Gen1 Collections"), STAT_UnrealSharp_Gen1Collections, STATGROUP_UnrealSharp);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Managed Gen2 Collections"), STAT_UnrealSharp_Gen2Collections, STATGROUP_UnrealSharp);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Managed GC Pause (ms)"), STAT_UnrealSharp_ManagedGCPause, STATGROUP_UnrealSharp);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Managed Time (ms)"), STAT_UnrealSharp_ManagedTime, STATGROUP_UnrealSharp);
+
+CSV_DEFINE_CATEGORY(UnrealSharp, true);
+
+void FCSManagedStats::Initialize()
+{
+	FCSManagedCallbacks::ManagedCallbacks.GetGCStats(&LastStats);
+	TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateStatic(&FCSManagedStats::Tick));
+}
+
+void FCSManagedStats::Shutdown()
+{
+	FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+	TickerHandle.Reset();
+}
+
+bool FCSManagedStats::Tick(float DeltaTime)
+{
+	FCSManagedGCStats Stats;
+	FCSManagedCallbacks::ManagedCallbacks.GetGCStats(&Stats);
+
+	const float AllocatedKB = (Stats.TotalAllocatedBytes - LastStats.TotalAllocatedBytes) / 1024.0f;
+	const float PauseMs = Stats.TotalPauseMs - LastStats.TotalPauseMs;
+	const int32 Gen0Collections = Stats.Gen0Collections - LastStats.Gen0Collections;
+	const int32 Gen1Collections = Stats.Gen1Collections - LastStats.Gen1Collections;
+	const int32 Gen2Collections = Stats.Gen2Collections - LastStats.Gen2Collections;
+	const float ManagedMs = FPlatformTime::ToMilliseconds64(ManagedCycles);
+
+	LastStats = Stats;
+	ManagedCycles = 0;
+
+	SET_MEMORY_STAT(STAT_UnrealSharp_ManagedHeapSize, Stats.HeapSizeBytes);
+	SET_MEMORY_STAT(STAT_UnrealSharp_ManagedCommittedMemory, Stats.CommittedBytes);
+	SET_FLOAT_STAT(STAT_UnrealSharp_ManagedAllocations, AllocatedKB);
+	SET_DWORD_STAT(STAT_UnrealSharp_Gen0Collections, Gen0Collections);
+	SET_DWORD_STAT(STAT_UnrealSharp_Gen1Collections, Gen1Collections);
+	SET_DWORD_STAT(STAT_UnrealSharp_Gen2Collections, Gen2Collections);
+	SET_FLOAT_STAT(STAT_UnrealSharp_ManagedGCPause, PauseMs);
+	SET_FLOAT_STAT(STAT_UnrealSharp_ManagedTime, ManagedMs);
+
+	CSV_CUSTOM_STAT(UnrealSharp, ManagedHeapMB, Stats.HeapSizeBytes / (1024.0f * 1024.0f), ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(UnrealSharp, ManagedAllocationsKB, AllocatedKB, ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(UnrealSharp, Gen0Collections, Gen0Collections, ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(UnrealSharp, Gen1Collections, Gen1Collections, ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(UnrealSharp, Gen2Collections, Gen2Collections, ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(UnrealSharp, ManagedGCPauseMs, PauseMs, ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(UnrealSharp, ManagedTimeMs, ManagedMs, ECsvCustomStatOp::Set);
+
+	// Makes managed GC hitches show up next to the engine's own events in the CSV.
+	if (Gen2Collections > 0)
+	{
+		CSV_EVENT(UnrealSharp, TEXT("Managed Gen2 GC (%.2f ms)"), PauseMs);
+	}
+	
+	return true;
+}
+
+#endif
@@ -0,0 +1,78 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "HAL/PlatformTime.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+
+// Managed GC and allocation counters and time spent in managed code, published per frame to "stat unrealsharp"
+// and the UnrealSharp CSV profiler category. Compiled out when neither stats nor the CSV profiler are.
+#ifndef WITH_CSHARP_MANAGED_STATS
+#define WITH_CSHARP_MANAGED_STATS (STATS || CSV_PROFILER)
+#endif
+
+// Filled by managed code, matches ManagedGCStats.cs.
+// Everything but the heap sizes is cumulative since the runtime started.
+// Each collection is counted once, under the highest generation it collected.
+struct FCSManagedGCStats
+{
+	int64 HeapSizeBytes = 0;
+	int64 CommittedBytes = 0;
+	int64 TotalAllocatedBytes = 0;
+	double TotalPauseMs = 0.0;
+	int32 Gen0Collections = 0;
+	int32 Gen1Collections = 0;
+	int32 Gen2Collections = 0;
+};
+
+#if WITH_CSHARP_MANAGED_STATS
+
+CSV_DECLARE_CATEGORY_EXTERN(UnrealSharp);
+
+class CSHARPFORUE_API FCSManagedStats
+{
+public:
+
+	static void Initialize();
+	static void Shutdown();
+
+	// Game thread time spent in managed code since the last frame was published.
+	static inline uint64 ManagedCycles = 0;
+	static inline int32 ManagedCallDepth = 0;
+
+private:
+
+	static bool Tick(float DeltaTime);
+
+	static inline FCSManagedGCStats LastStats;
+	static inline FTSTicker::FDelegateHandle TickerHandle;
+};
+
+// Adds the time until the outermost call back into native returns to the frame's managed time.
+// Only game thread calls are counted, so the total can be compared with the frame time.
+struct FCSScopedManagedTime
+{
+	FCSScopedManagedTime()
+		: bGameThread(IsInGameThread())
+	{
+		if (bGameThread && FCSManagedStats::ManagedCallDepth++ == 0)
+		{
+			StartCycles = FPlatformTime::Cycles64();
+		}
+	}
+
+	~FCSScopedManagedTime()
+	{
+		if (bGameThread && --FCSManagedStats::ManagedCallDepth == 0)
+		{
+			FCSManagedStats::ManagedCycles += FPlatformTime::Cycles64() - StartCycles;
+		}
+	}
+
+private:
+
+	bool bGameThread;
+	uint64 StartCycles = 0;
+};
+
+#endif
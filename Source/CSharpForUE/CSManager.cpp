@@ -2,6 +2,10 @@
 #include "CSManagedGCHandle.h"
 #include "CSAssembly.h"
 #include "CSharpForUE.h"
+#include "CSStartupTimings.h"
+#include "CSManagedStats.h"
+#include "CSManagedGCCoordinator.h"
+#include "CSInteropStats.h"
 #include "Export/FunctionsExporter.h"
 #include "TypeGenerator/CSClass.h"
 #include "TypeGenerator/Factories/CSPropertyFactory.h"
@@ -10,6 +14,8 @@
 #include "TypeGenerator/Register/CSTypeRegistry.h"
 #include "Misc/Paths.h"
 #include "Misc/App.h"
+#include "CSDeveloperSettings.h"
+#include "UObject/UObjectHash.h"
 #include "UObject/Object.h"
 #include "Misc/MessageDialog.h"
 #include "Engine/Blueprint.h"
@@ -21,9 +27,58 @@
 #include "AssetToolsModule.h"
 #endif
 
+DECLARE_CYCLE_STAT(TEXT("Run Game Thread Continuations"), STAT_UnrealSharp_RunGameThreadContinuations, STATGROUP_UnrealSharp);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Game Thread Continuations Ran"), STAT_UnrealSharp_GameThreadContinuationsRan, STATGROUP_UnrealSharp);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Game Thread Continuations Queued"), STAT_UnrealSharp_GameThreadContinuationsQueued, STATGROUP_UnrealSharp);
+
 FUSScriptEngine* FCSManager::UnrealSharpScriptEngine = nullptr;
 UPackage* FCSManager::UnrealSharpPackage = nullptr;
 
+namespace
+{
+	const int32* GetObjectFlagsAddress(FUObjectItem* ObjectItem)
+	{
+		// The internal flags come right after the object pointer, in the low bits if they're packed with the ref count.
+		return reinterpret_cast<const int32*>(reinterpret_cast<const uint8*>(ObjectItem) + sizeof(UObjectBase*));
+	}
+	
+	// Managed objects read their internal flags straight from the object array to check for garbage.
+	// Verify once that the flags really are where we expect them in this engine version, otherwise they fall back to asking native.
+	bool CanReadObjectFlagsDirectly()
+	{
+		static const bool bCanReadObjectFlags = []
+		{
+			int32 NumChecked = 0;
+			for (int32 Index = 0; Index < GUObjectArray.GetObjectArrayNum() && NumChecked < 64; ++Index)
+			{
+				FUObjectItem* ObjectItem = GUObjectArray.IndexToObject(Index);
+				
+				if (!ObjectItem || !ObjectItem->Object)
+				{
+					continue;
+				}
+
+				if (*GetObjectFlagsAddress(ObjectItem) != static_cast<int32>(ObjectItem->GetFlags()))
+				{
+					UE_LOG(LogUnrealSharp, Warning, TEXT("Unexpected object array layout, managed validity checks will call into native."));
+					return false;
+				}
+
+				++NumChecked;
+			}
+
+			return NumChecked > 0;
+		}();
+
+		return bCanReadObjectFlags;
+	}
+}
+
+int32 FCSManager::GetObjectItemFlagsOffset()
+{
+	return CanReadObjectFlagsDirectly() ? sizeof(UObjectBase*) : INDEX_NONE;
+}
+
 void FCSManager::InitializeUnrealSharp()
 {
 	FString DotNetInstallationPath =  FCSProcHelper::GetDotNetDirectory();
@@ -39,16 +94,32 @@ void FCSManager::InitializeUnrealSharp()
 
 	if (!FParse::Param(FCommandLine::Get(), TEXT("game"))) 
 	{
-		FCSGenerator::Get().StartGenerator(FCSProcHelper::GetGeneratedClassesDirectory());
+		{
+			CS_STARTUP_PHASE(TEXT("GenerateGlue"));
+			FCSGenerator::Get().StartGenerator(FCSProcHelper::GetGeneratedClassesDirectory());
+		}
+		
 		if (!FApp::IsUnattended()) 
 		{
-			if (!FCSProcHelper::BuildBindings())
+			bool bBuiltBindings;
+			{
+				CS_STARTUP_PHASE(TEXT("BuildBindings"));
+				bBuiltBindings = FCSProcHelper::BuildBindings();
+			}
+			
+			if (!bBuiltBindings)
 			{
 				UE_LOG(LogUnrealSharp, Fatal, TEXT("C# binding failed"));
 				return;
 			}
 
-			if (!FCSProcHelper::GenerateProject())
+			bool bGeneratedProject;
+			{
+				CS_STARTUP_PHASE(TEXT("GenerateProject"));
+				bGeneratedProject = FCSProcHelper::GenerateProject();
+			}
+
+			if (!bGeneratedProject)
 			{
 				InitializeUnrealSharp();
 				return;
@@ -82,8 +153,22 @@ void FCSManager::InitializeUnrealSharp()
 		return;
 	}
 
+	// Resume awaited C# code on the game thread in one batch per frame.
+	GameThreadContinuationsHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FCSManager::RunGameThreadContinuations));
+
+#if WITH_CSHARP_MANAGED_STATS
+	// Publish managed GC and allocation counters once per frame.
+	FCSManagedStats::Initialize();
+#endif
+
+	// Keep .NET collections out of the engine's GC, if enabled in the settings.
+	FCSManagedGCCoordinator::Initialize();
+
 	// Initialize property factory before making the classes.
-	FCSPropertyFactory::InitializePropertyFactory();
+	{
+		CS_STARTUP_PHASE(TEXT("InitializePropertyFactory"));
+		FCSPropertyFactory::InitializePropertyFactory();
+	}
 
 	// Try to load the user assembly, can be null when the project is first created.
 	LoadUserAssembly();
@@ -91,6 +176,8 @@ void FCSManager::InitializeUnrealSharp()
 
 bool FCSManager::InitializeBindings()
 {
+	CS_STARTUP_PHASE(TEXT("InitializeBindings"));
+	
 	if (!LoadRuntimeHost())
 	{
 		UE_LOG(LogUnrealSharp, Fatal, TEXT("Failed to load Runtime Host"));
@@ -98,12 +185,15 @@ bool FCSManager::InitializeBindings()
 	}
 	
 	load_assembly_and_get_function_pointer_fn LoadAssemblyAndGetFunctionPointer;
-	
+	{
+		CS_STARTUP_PHASE(TEXT("InitializeHostfxr"));
+		
 #if WITH_EDITOR
-	LoadAssemblyAndGetFunctionPointer = InitializeHostfxr();
+		LoadAssemblyAndGetFunctionPointer = InitializeHostfxr();
 #else
-	LoadAssemblyAndGetFunctionPointer = InitializeHostfxrSelfContained();
+		LoadAssemblyAndGetFunctionPointer = InitializeHostfxrSelfContained();
 #endif
+	}
 	
 	if (!LoadAssemblyAndGetFunctionPointer)
 	{
@@ -114,17 +204,23 @@ bool FCSManager::InitializeBindings()
 	// Load assembly and get function pointer.
 	FInitializeRuntimeHost InitializeUnrealSharp = nullptr;
 	
-	const char_t* EntryPointClassName = TEXT("UnrealSharp.Plugins.Main, UnrealSharp.Plugins");
-	const char_t* EntryPointFunctionName = TEXT("InitializeUnrealSharp");
+	// hostfxr takes wide strings on Windows and UTF-8 everywhere else.
+	const auto EntryPointClassName = StringCast<char_t>(TEXT("UnrealSharp.Plugins.Main, UnrealSharp.Plugins"));
+	const auto EntryPointFunctionName = StringCast<char_t>(TEXT("InitializeUnrealSharp"));
 
 	const FString UnrealSharpLibraryAssembly = FPaths::ConvertRelativePathToFull(FCSProcHelper::GetUnrealSharpLibraryPath());
+	const auto UnrealSharpLibraryAssemblyPath = StringCast<char_t>(*UnrealSharpLibraryAssembly);
 	
-	const int32 ErrorCode = LoadAssemblyAndGetFunctionPointer(*UnrealSharpLibraryAssembly,
-		EntryPointClassName,
-		EntryPointFunctionName,
-		UNMANAGEDCALLERSONLY_METHOD,
-		nullptr,
-		reinterpret_cast<void**>(&InitializeUnrealSharp));
+	int32 ErrorCode;
+	{
+		CS_STARTUP_PHASE(TEXT("LoadUnrealSharpLibrary"));
+		ErrorCode = LoadAssemblyAndGetFunctionPointer(UnrealSharpLibraryAssemblyPath.Get(),
+			EntryPointClassName.Get(),
+			EntryPointFunctionName.Get(),
+			UNMANAGEDCALLERSONLY_METHOD,
+			nullptr,
+			reinterpret_cast<void**>(&InitializeUnrealSharp));
+	}
 	
 	if (ErrorCode != 0)
 	{
@@ -133,6 +229,7 @@ bool FCSManager::InitializeBindings()
 	}
 
 	// Entry point to C# to initialize UnrealSharp
+	CS_STARTUP_PHASE(TEXT("InitializeManagedRuntime"));
 	if (!InitializeUnrealSharp(*UnrealSharpLibraryAssembly, &ManagedPluginsCallbacks, &FCSManagedCallbacks::ManagedCallbacks, &UFunctionsExporter::StartExportingAPI))
 	{
 		UE_LOG(LogUnrealSharp, Fatal, TEXT("Failed to initialize UnrealSharp!"));
@@ -210,11 +307,15 @@ load_assembly_and_get_function_pointer_fn FCSManager::InitializeHostfxr() const
 	FString DotNetPath = FCSProcHelper::GetDotNetDirectory();
 	FString RuntimeHostPath =  FCSProcHelper::GetRuntimeHostPath();
 
+	const auto DotNetRoot = StringCast<char_t>(*DotNetPath);
+	const auto HostPath = StringCast<char_t>(*RuntimeHostPath);
+	const auto RuntimeConfig = StringCast<char_t>(*RuntimeConfigPath);
+
 	hostfxr_initialize_parameters InitializeParameters;
-	InitializeParameters.dotnet_root = *DotNetPath;
-	InitializeParameters.host_path = *RuntimeHostPath;
+	InitializeParameters.dotnet_root = DotNetRoot.Get();
+	InitializeParameters.host_path = HostPath.Get();
 	
-	int32 ErrorCode = Hostfxr_Initialize_For_Runtime_Config(*RuntimeConfigPath, &InitializeParameters, &HostFXR_Handle);
+	int32 ErrorCode = Hostfxr_Initialize_For_Runtime_Config(RuntimeConfig.Get(), &InitializeParameters, &HostFXR_Handle);
 	
 	if (ErrorCode != 0)
 	{
@@ -239,15 +340,19 @@ load_assembly_and_get_function_pointer_fn FCSManager::InitializeHostfxr() const
 load_assembly_and_get_function_pointer_fn FCSManager::InitializeHostfxrSelfContained() const
 {
 	FString MainAssemblyPath = FPaths::ConvertRelativePathToFull(FCSProcHelper::GetUnrealSharpLibraryPath());
-	std::vector Args { *MainAssemblyPath };
+	const auto MainAssembly = StringCast<char_t>(*MainAssemblyPath);
+	std::vector<const char_t*> Args { MainAssembly.Get() };
 	
 	hostfxr_handle HostFXR_Handle = nullptr;
 	FString DotNetPath = FCSProcHelper::GetAssembliesPath();
 	FString RuntimeHostPath =  FCSProcHelper::GetRuntimeHostPath();
 
+	const auto DotNetRoot = StringCast<char_t>(*DotNetPath);
+	const auto HostPath = StringCast<char_t>(*RuntimeHostPath);
+
 	hostfxr_initialize_parameters InitializeParameters;
-	InitializeParameters.dotnet_root = *DotNetPath;
-	InitializeParameters.host_path = *RuntimeHostPath;
+	InitializeParameters.dotnet_root = DotNetRoot.Get();
+	InitializeParameters.host_path = HostPath.Get();
 	
 	int ReturnCode = Hostfxr_Initialize_For_Dotnet_Command_Line(Args.size(), Args.data(), &InitializeParameters, &HostFXR_Handle);
 	
@@ -276,6 +381,8 @@ UPackage* FCSManager::GetUnrealSharpPackage()
 
 TSharedPtr<FCSAssembly> FCSManager::LoadAssembly(const FString& AssemblyPath)
 {
+	CS_STARTUP_PHASE(TEXT("LoadAssembly ") + FPaths::GetBaseFilename(AssemblyPath));
+	
 	TSharedPtr<FCSAssembly> NewPlugin = MakeShared<FCSAssembly>(AssemblyPath);
 	
 	if (!NewPlugin->Load())
@@ -316,21 +423,15 @@ FGCHandle FCSManager::CreateNewManagedObject(UObject* Object, UClass* Class)
 {
 	ensureAlways(!UnmanagedToManagedMap.Contains(Object));
 
-	UClass* ObjectClass = FCSGeneratedClassBuilder::GetFirstManagedClass(Class);
-	
-	if (!ObjectClass)
-	{
-		// If the class is not managed, we need to find the first native class.
-		ObjectClass = FCSGeneratedClassBuilder::GetFirstNativeClass(Class);
-	}
-	
-	TSharedRef<FCSharpClassInfo> ClassInfo = FCSTypeRegistry::Get().FindManagedType(ObjectClass);
+	// If the class is not managed, the object is created as its first native class.
+	TSharedRef<FCSharpClassInfo> ClassInfo = FCSGeneratedClassBuilder::GetManagedClassInfo(Class);
 	return CreateNewManagedObject(Object, ClassInfo->TypeHandle);
 }
 
 FGCHandle FCSManager::CreateNewManagedObject(UObject* Object, uint8* TypeHandle)
 {
-	FGCHandle NewManagedObject = FCSManagedCallbacks::ManagedCallbacks.CreateNewManagedObject(Object, TypeHandle);
+	const int32* ObjectFlags = CanReadObjectFlagsDirectly() ? GetObjectFlagsAddress(GUObjectArray.ObjectToObjectItem(Object)) : nullptr;
+	FGCHandle NewManagedObject = FCSManagedCallbacks::ManagedCallbacks.CreateNewManagedObject(Object, TypeHandle, ObjectFlags);
 	NewManagedObject.Type = GCHandleType::StrongHandle;
 
 	if (NewManagedObject.IsNull())
@@ -368,6 +469,84 @@ void FCSManager::RemoveManagedObject(UObject* Object)
 	}
 }
 
+bool FCSManager::RunGameThreadContinuations(float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_UnrealSharp_RunGameThreadContinuations);
+	
+	const float Budget = GetDefault<UCSDeveloperSettings>()->GameThreadContinuationBudget;
+
+	int32 RanCount = 0;
+#if WITH_CSHARP_MANAGED_STATS
+	FCSScopedManagedTime ManagedTime;
+#endif
+	const int32 QueuedCount = FCSManagedCallbacks::ManagedCallbacks.RunGameThreadContinuations(Budget, &RanCount);
+	
+	SET_DWORD_STAT(STAT_UnrealSharp_GameThreadContinuationsRan, RanCount);
+	SET_DWORD_STAT(STAT_UnrealSharp_GameThreadContinuationsQueued, QueuedCount);
+	return true;
+}
+
+void FCSManager::RecreateManagedObjects(UClass* ManagedClass)
+{
+	TArray<UObject*> Objects;
+	GetObjectsOfClass(ManagedClass, Objects, true, RF_NoFlags);
+
+	// The managed constructor runs again, and its property initializers would reset the values the objects already have.
+	// Only properties declared by managed classes are written by it, so only those are kept aside, one object at a time.
+	TArray<const FProperty*> ManagedProperties;
+	TArray<int32> SavedOffsets;
+	int32 SavedSize = 0;
+	int32 SavedAlignment = 1;
+
+	for (UClass* Class = ManagedClass; Class && FCSGeneratedClassBuilder::IsManagedType(Class); Class = Class->GetSuperClass())
+	{
+		for (TFieldIterator<FProperty> PropertyIt(Class, EFieldIteratorFlags::ExcludeSuper); PropertyIt; ++PropertyIt)
+		{
+			const FProperty* Property = *PropertyIt;
+			SavedOffsets.Add(Align(SavedSize, Property->GetMinAlignment()));
+			SavedSize = SavedOffsets.Last() + Property->GetSize();
+			SavedAlignment = FMath::Max(SavedAlignment, Property->GetMinAlignment());
+			ManagedProperties.Add(Property);
+		}
+	}
+
+	uint8* SavedValues = static_cast<uint8*>(FMemory::Malloc(FMath::Max(SavedSize, 1), SavedAlignment));
+
+	for (UObject* Object : Objects)
+	{
+		// Instances of managed subclasses are handled when their own class is reloaded.
+		if (FCSGeneratedClassBuilder::GetFirstManagedClass(Object->GetClass()) != ManagedClass)
+		{
+			continue;
+		}
+
+		// Objects without a managed counterpart yet get one from the new assembly when they are first used.
+		if (!UnmanagedToManagedMap.Contains(Object))
+		{
+			continue;
+		}
+
+		for (int32 i = 0; i < ManagedProperties.Num(); ++i)
+		{
+			const FProperty* Property = ManagedProperties[i];
+			Property->InitializeValue(SavedValues + SavedOffsets[i]);
+			Property->CopyCompleteValue(SavedValues + SavedOffsets[i], Property->ContainerPtrToValuePtr<void>(Object));
+		}
+		
+		RemoveManagedObject(Object);
+		CreateNewManagedObject(Object, Object->GetClass());
+		
+		for (int32 i = 0; i < ManagedProperties.Num(); ++i)
+		{
+			const FProperty* Property = ManagedProperties[i];
+			Property->CopyCompleteValue(Property->ContainerPtrToValuePtr<void>(Object), SavedValues + SavedOffsets[i]);
+			Property->DestroyValue(SavedValues + SavedOffsets[i]);
+		}
+	}
+
+	FMemory::Free(SavedValues);
+}
+
 uint8* FCSManager::GetTypeHandle(const FString& AssemblyName, const FString& Namespace, const FString& TypeName)
 {
 	const TSharedPtr<FCSAssembly> Plugin = LoadedPlugins.FindRef(*AssemblyName);
@@ -395,6 +574,22 @@ uint8* FCSManager::GetTypeHandle(const FCSTypeReferenceMetaData& TypeMetaData)
 	return GetTypeHandle(TypeMetaData.AssemblyName.ToString(), TypeMetaData.Namespace.ToString(), TypeMetaData.Name.ToString());
 }
 
+void FCSManager::ShutdownUnrealSharp()
+{
+	FTSTicker::GetCoreTicker().RemoveTicker(GameThreadContinuationsHandle);
+	GameThreadContinuationsHandle.Reset();
+
+#if WITH_CSHARP_MANAGED_STATS
+	FCSManagedStats::Shutdown();
+#endif
+
+#if WITH_CSHARP_INTEROP_STATS
+	FCSInteropStats::Shutdown();
+#endif
+
+	FCSManagedGCCoordinator::Shutdown();
+}
+
 void FCSManager::NotifyUObjectDeleted(const UObjectBase* ObjectBase, int32 Index)
 {
 	UObjectBase* NonConstObject = const_cast<UObjectBase*>(ObjectBase);
@@ -4,6 +4,7 @@
 #include <hostfxr.h>
 #include "CSAssembly.h"
 #include "CSManagedCallbacksCache.h"
+#include "Containers/Ticker.h"
 
 struct FCSTypeReferenceMetaData;
 class FUSScriptEngine;
@@ -28,8 +29,14 @@ public:
 
 	void InitializeUnrealSharp();
 
+	// Unregisters everything InitializeUnrealSharp hooked into the engine, so nothing calls into a module that's gone.
+	void ShutdownUnrealSharp();
+
 	static UPackage* GetUnrealSharpPackage();
 
+	// Offset of the internal flags in FUObjectItem, or INDEX_NONE if managed code can't read them directly in this engine version.
+	static int32 GetObjectItemFlagsOffset();
+
 	TSharedPtr<FCSAssembly> LoadAssembly(const FString& AssemblyPath);
 	bool UnloadAssembly(const FString& AssemblyName);
 
@@ -40,11 +47,17 @@ public:
 	
 	void RemoveManagedObject(UObject* Object);
 
+	// Gives existing instances of a managed class new managed objects, after the class was reloaded without being reinstanced.
+	void RecreateManagedObjects(UClass* ManagedClass);
+
 	uint8* GetTypeHandle(const FString& AssemblyName, const FString& Namespace, const FString& TypeName);
 	uint8* GetTypeHandle(const FCSTypeReferenceMetaData& TypeMetaData);
 
 	bool LoadUserAssembly();
 
+	// Runs the managed continuations queued for the game thread, once per frame.
+	bool RunGameThreadContinuations(float DeltaTime);
+
 	TMap<FName, TSharedPtr<FCSAssembly>> LoadedPlugins;
 	TMap<UObject*, FGCHandle> UnmanagedToManagedMap;
 	
@@ -72,6 +85,8 @@ private:
 	hostfxr_get_runtime_delegate_fn Hostfxr_Get_Runtime_Delegate = nullptr;
 	hostfxr_close_fn Hostfxr_Close = nullptr;
 
+	FTSTicker::FDelegateHandle GameThreadContinuationsHandle;
+
 	void* RuntimeHost = nullptr;
 	void* UnrealSharpLibraryDLL = nullptr;
 	void* UserScriptsDLL = nullptr;
@@ -0,0 +1,113 @@
+﻿#include "CSStartupTimings.h"
+#include "CSharpForUE.h"
+
+namespace
+{
+	struct FStartupPhase
+	{
+		FString Name;
+		int32 Depth;
+		double Seconds;
+	};
+
+	bool bRecording = false;
+	double StartupStartTime = 0.0;
+	int32 CurrentDepth = 0;
+	
+	TArray<FStartupPhase> Phases;
+	TArray<TPair<FName, double>> TypeBuildTimes;
+
+	int32 GetNumSlowestTypes()
+	{
+		int32 NumSlowestTypes = 10;
+		FParse::Value(FCommandLine::Get(), TEXT("UnrealSharpSlowestTypes="), NumSlowestTypes);
+		return NumSlowestTypes;
+	}
+}
+
+void FCSStartupTimings::BeginStartup()
+{
+	bRecording = true;
+	StartupStartTime = FPlatformTime::Seconds();
+	CurrentDepth = 0;
+	Phases.Reset();
+	TypeBuildTimes.Reset();
+}
+
+void FCSStartupTimings::EndStartup()
+{
+	if (!bRecording)
+	{
+		return;
+	}
+
+	bRecording = false;
+	const double TotalSeconds = FPlatformTime::Seconds() - StartupStartTime;
+	
+	UE_LOG(LogUnrealSharp, Display, TEXT("UnrealSharp startup took %.1f ms:"), TotalSeconds * 1000.0);
+
+	for (const FStartupPhase& Phase : Phases)
+	{
+		UE_LOG(LogUnrealSharp, Display, TEXT("  %s%s: %.1f ms"), *FString::ChrN(Phase.Depth * 2, TEXT(' ')), *Phase.Name, Phase.Seconds * 1000.0);
+	}
+
+	if (TypeBuildTimes.IsEmpty())
+	{
+		return;
+	}
+
+	TypeBuildTimes.Sort([](const TPair<FName, double>& A, const TPair<FName, double>& B)
+	{
+		return A.Value > B.Value;
+	});
+
+	const int32 NumSlowestTypes = FMath::Min(GetNumSlowestTypes(), TypeBuildTimes.Num());
+	UE_LOG(LogUnrealSharp, Display, TEXT("Built %d types, slowest %d:"), TypeBuildTimes.Num(), NumSlowestTypes);
+	
+	for (int32 Index = 0; Index < NumSlowestTypes; ++Index)
+	{
+		UE_LOG(LogUnrealSharp, Display, TEXT("  %s: %.2f ms"), *TypeBuildTimes[Index].Key.ToString(), TypeBuildTimes[Index].Value * 1000.0);
+	}
+
+	TypeBuildTimes.Empty();
+}
+
+bool FCSStartupTimings::IsRecording()
+{
+	return bRecording;
+}
+
+FCSStartupTimings::FScopedPhase::FScopedPhase(const FString& InName)
+	: PhaseIndex(INDEX_NONE)
+	, StartTime(FPlatformTime::Seconds())
+{
+	if (!bRecording)
+	{
+		return;
+	}
+
+	// Added up front so nested phases are listed under their parent.
+	PhaseIndex = Phases.Add({ InName, CurrentDepth, 0.0 });
+	++CurrentDepth;
+}
+
+FCSStartupTimings::FScopedPhase::~FScopedPhase()
+{
+	if (PhaseIndex == INDEX_NONE || !Phases.IsValidIndex(PhaseIndex))
+	{
+		return;
+	}
+	
+	Phases[PhaseIndex].Seconds = FPlatformTime::Seconds() - StartTime;
+	--CurrentDepth;
+}
+
+void FCSStartupTimings::AddTypeBuildTime(FName TypeName, double Seconds)
+{
+	if (!bRecording)
+	{
+		return;
+	}
+
+	TypeBuildTimes.Add(MakeTuple(TypeName, Seconds));
+}
@@ -0,0 +1,37 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+
+// Wall clock breakdown of UnrealSharp startup, logged as one summary once startup finishes.
+// Each phase is also a CPU trace event, so it shows up in Unreal Insights with -trace=cpu.
+class CSHARPFORUE_API FCSStartupTimings
+{
+public:
+
+	static void BeginStartup();
+	
+	// Logs every phase and the slowest types to build, then stops recording.
+	static void EndStartup();
+
+	static bool IsRecording();
+
+	struct CSHARPFORUE_API FScopedPhase
+	{
+		explicit FScopedPhase(const FString& InName);
+		~FScopedPhase();
+
+	private:
+		
+		int32 PhaseIndex;
+		double StartTime;
+	};
+
+	// Includes the time spent building any types this one pulled in, like its parent class.
+	static void AddTypeBuildTime(FName TypeName, double Seconds);
+	
+};
+
+#define CS_STARTUP_PHASE(Name) \
+	TRACE_CPUPROFILER_EVENT_SCOPE_TEXT(*FString(Name)); \
+	FCSStartupTimings::FScopedPhase ANONYMOUS_VARIABLE(StartupPhase_)(Name);
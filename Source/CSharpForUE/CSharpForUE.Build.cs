@@ -1,6 +1,7 @@
 ﻿using System;
 using System.Diagnostics;
 using System.IO;
+using System.Linq;
 using UnrealBuildTool;
 
 enum BuildConfiguration
@@ -83,6 +84,24 @@ public class CSharpForUE : ModuleRules
 		}
     
 		var paths = pathVariable.Split(Path.PathSeparator);
+
+		if (!OperatingSystem.IsWindows())
+		{
+			// The engine doesn't ship a dotnet outside Windows, so the first one found is the installed SDK.
+			var dotnetRoot = Environment.GetEnvironmentVariable("DOTNET_ROOT");
+			
+			foreach (var path in string.IsNullOrEmpty(dotnetRoot) ? paths : paths.Prepend(dotnetRoot))
+			{
+				var dotnetPath = Path.Combine(path, "dotnet");
+				
+				if (File.Exists(dotnetPath))
+				{
+					return dotnetPath;
+				}
+			}
+			
+			throw new Exception("Couldn't find dotnet!");
+		}
     
 		foreach (var path in paths)
 		{
@@ -3,6 +3,7 @@
 #include "CSharpForUE.h"
 #include "CoreMinimal.h"
 #include "CSManager.h"
+#include "CSStartupTimings.h"
 #include "Modules/ModuleManager.h"
 
 #define LOCTEXT_NAMESPACE "FCSharpForUEModule"
@@ -11,12 +12,15 @@ DEFINE_LOG_CATEGORY(LogUnrealSharp);
 
 void FCSharpForUEModule::StartupModule()
 {
+	FCSStartupTimings::BeginStartup();
 	FCSManager::Get().InitializeUnrealSharp();
+	FCSStartupTimings::EndStartup();
 }
 
 void FCSharpForUEModule::ShutdownModule()
 {
 	UE_LOG(LogUnrealSharp, Warning, TEXT("CSharpForUE module shutting down"));
+	FCSManager::Get().ShutdownUnrealSharp();
 }
 
 #undef LOCTEXT_NAMESPACE
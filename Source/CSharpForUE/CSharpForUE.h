@@ -4,9 +4,12 @@
 
 #include "CoreMinimal.h"
 #include "Modules/ModuleManager.h"
+#include "Stats/Stats.h"
 
 DECLARE_LOG_CATEGORY_EXTERN(LogUnrealSharp, Log, All);
 
+DECLARE_STATS_GROUP(TEXT("UnrealSharp"), STATGROUP_UnrealSharp, STATCAT_Advanced);
+
 class FCSharpForUEModule : public IModuleInterface
 {
 public:
@@ -1,6 +1,7 @@
 ﻿#include "AsyncExporter.h"
 #include "CSharpForUE/CSManager.h"
 #include "CSManagedCallbacksCache.h"
+#include "CSharpForUE/CSManagedStats.h"
 #include "HAL/ThreadManager.h"
 
 void UAsyncExporter::ExportFunctions(FRegisterExportedFunction RegisterExportedFunction)
@@ -14,6 +15,9 @@ void UAsyncExporter::RunOnThread(ENamedThreads::Type Thread, GCHandleIntPtr Dele
 	AsyncTask(Thread, [=]()
 	{
 		FGCHandle GCHandle(DelegateHandle);
+#if WITH_CSHARP_MANAGED_STATS
+		FCSScopedManagedTime ManagedTime;
+#endif
 		FCSManagedCallbacks::ManagedCallbacks.InvokeDelegate(DelegateHandle);
 		GCHandle.Dispose();
 	});
@@ -8,6 +8,9 @@ void UFMulticastDelegatePropertyExporter::ExportFunctions(FRegisterExportedFunct
 	EXPORT_FUNCTION(BroadcastDelegate)
 	EXPORT_FUNCTION(GetSignatureFunction)
 	EXPORT_FUNCTION(ContainsDelegate)
+	EXPORT_FUNCTION(AddManagedDelegate)
+	EXPORT_FUNCTION(RemoveManagedDelegate)
+	EXPORT_FUNCTION(GetManagedDelegateHandler)
 }
 
 void UFMulticastDelegatePropertyExporter::AddDelegate(FMulticastDelegateProperty* DelegateProperty, FMulticastScriptDelegate* Delegate, UObject* Target, const char* FunctionName)
@@ -24,7 +27,15 @@ void UFMulticastDelegatePropertyExporter::RemoveDelegate(FMulticastDelegatePrope
 
 void UFMulticastDelegatePropertyExporter::ClearDelegate(FMulticastDelegateProperty* DelegateProperty, FMulticastScriptDelegate* Delegate)
 {
+	TArray<UCSManagedDelegateTarget*> ManagedTargets;
+	GetManagedDelegateTargets(DelegateProperty, Delegate, ManagedTargets);
+	
 	DelegateProperty->ClearDelegate(nullptr, Delegate);
+
+	for (UCSManagedDelegateTarget* ManagedTarget : ManagedTargets)
+	{
+		ManagedTarget->Release();
+	}
 }
 
 void UFMulticastDelegatePropertyExporter::BroadcastDelegate(FMulticastDelegateProperty* DelegateProperty, const FMulticastScriptDelegate* Delegate, void* Parameters)
@@ -45,6 +56,50 @@ void* UFMulticastDelegatePropertyExporter::GetSignatureFunction(FMulticastDelega
 	return DelegateProperty->SignatureFunction;
 }
 
+void UFMulticastDelegatePropertyExporter::AddManagedDelegate(FMulticastDelegateProperty* DelegateProperty, FMulticastScriptDelegate* Delegate, GCHandleIntPtr Handler, UCSManagedDelegateTarget::FInvokeManagedHandler Invoker)
+{
+	UObject* Owner = TryGetDelegateOwner(DelegateProperty, Delegate);
+	UCSManagedDelegateTarget* Target = UCSManagedDelegateTarget::Create(Owner, Handler, Invoker, DelegateProperty->SignatureFunction);
+
+	FScriptDelegate NewScriptDelegate;
+	NewScriptDelegate.BindUFunction(Target, UCSManagedDelegateTarget::GetInvokeFunctionName());
+	DelegateProperty->AddDelegate(NewScriptDelegate, nullptr, Delegate);
+}
+
+void UFMulticastDelegatePropertyExporter::RemoveManagedDelegate(FMulticastDelegateProperty* DelegateProperty, FMulticastScriptDelegate* Delegate, GCHandleIntPtr Handler)
+{
+	TArray<UCSManagedDelegateTarget*> ManagedTargets;
+	GetManagedDelegateTargets(DelegateProperty, Delegate, ManagedTargets);
+
+	for (UCSManagedDelegateTarget* ManagedTarget : ManagedTargets)
+	{
+		if (ManagedTarget->GetHandler().GetHandle() != Handler)
+		{
+			continue;
+		}
+
+		FScriptDelegate ScriptDelegate;
+		ScriptDelegate.BindUFunction(ManagedTarget, UCSManagedDelegateTarget::GetInvokeFunctionName());
+		DelegateProperty->RemoveDelegate(ScriptDelegate, nullptr, Delegate);
+
+		ManagedTarget->Release();
+		return;
+	}
+}
+
+GCHandleIntPtr UFMulticastDelegatePropertyExporter::GetManagedDelegateHandler(FMulticastDelegateProperty* DelegateProperty, const FMulticastScriptDelegate* Delegate, int32 Index)
+{
+	TArray<UCSManagedDelegateTarget*> ManagedTargets;
+	GetManagedDelegateTargets(DelegateProperty, Delegate, ManagedTargets);
+
+	if (!ManagedTargets.IsValidIndex(Index))
+	{
+		return GCHandleIntPtr();
+	}
+
+	return ManagedTargets[Index]->GetHandler().GetHandle();
+}
+
 FScriptDelegate UFMulticastDelegatePropertyExporter::MakeScriptDelegate(UObject* Target, const char* FunctionName)
 {
 	FScriptDelegate NewDelegate;
@@ -62,3 +117,35 @@ const FMulticastScriptDelegate* UFMulticastDelegatePropertyExporter::TryGetSpars
 
 	return Delegate;
 }
+
+UObject* UFMulticastDelegatePropertyExporter::TryGetDelegateOwner(FMulticastDelegateProperty* DelegateProperty, const FMulticastScriptDelegate* Delegate)
+{
+	// Delegates declared on a class live inside the object, at the property's offset.
+	// Delegates in structs can't be traced back to an object, their managed targets live until they're removed.
+	UClass* OwnerClass = DelegateProperty->GetOwner<UClass>();
+	if (!OwnerClass)
+	{
+		return nullptr;
+	}
+
+	UObject* Owner = reinterpret_cast<UObject*>(reinterpret_cast<uintptr_t>(Delegate) - DelegateProperty->GetOffset_ForInternal());
+	return Owner->IsA(OwnerClass) ? Owner : nullptr;
+}
+
+void UFMulticastDelegatePropertyExporter::GetManagedDelegateTargets(FMulticastDelegateProperty* DelegateProperty, const FMulticastScriptDelegate* Delegate, TArray<UCSManagedDelegateTarget*>& OutTargets)
+{
+	Delegate = TryGetSparseMulticastDelegate(DelegateProperty, Delegate);
+
+	if (!Delegate)
+	{
+		return;
+	}
+
+	for (UObject* BoundObject : Delegate->GetAllObjects())
+	{
+		if (UCSManagedDelegateTarget* ManagedTarget = Cast<UCSManagedDelegateTarget>(BoundObject))
+		{
+			OutTargets.Add(ManagedTarget);
+		}
+	}
+}
@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "FunctionsExporter.h"
+#include "CSharpForUE/CSManagedDelegateTarget.h"
 #include "FMulticastDelegatePropertyExporter.generated.h"
 
 struct Interop_FScriptDelegate
@@ -40,7 +41,13 @@ private:
 
 	static void* GetSignatureFunction(FMulticastDelegateProperty* DelegateProperty);
 
+	static void AddManagedDelegate(FMulticastDelegateProperty* DelegateProperty, FMulticastScriptDelegate* Delegate, GCHandleIntPtr Handler, UCSManagedDelegateTarget::FInvokeManagedHandler Invoker);
+	static void RemoveManagedDelegate(FMulticastDelegateProperty* DelegateProperty, FMulticastScriptDelegate* Delegate, GCHandleIntPtr Handler);
+	static GCHandleIntPtr GetManagedDelegateHandler(FMulticastDelegateProperty* DelegateProperty, const FMulticastScriptDelegate* Delegate, int32 Index);
+
 	static FScriptDelegate MakeScriptDelegate(UObject* Target, const char* FunctionName);
 	static const FMulticastScriptDelegate* TryGetSparseMulticastDelegate(FMulticastDelegateProperty* DelegateProperty, const FMulticastScriptDelegate* Delegate);
+	static UObject* TryGetDelegateOwner(FMulticastDelegateProperty* DelegateProperty, const FMulticastScriptDelegate* Delegate);
+	static void GetManagedDelegateTargets(FMulticastDelegateProperty* DelegateProperty, const FMulticastScriptDelegate* Delegate, TArray<UCSManagedDelegateTarget*>& OutTargets);
 	
 };
@@ -1,9 +1,26 @@
 ﻿#include "FSoftObjectPtrExporter.h"
+#include "CSharpForUE/CSharpForUE.h"
 #include "CSharpForUE/CSManager.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
+
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Managed Async Loads In Flight"), STAT_UnrealSharp_AsyncLoadsInFlight, STATGROUP_UnrealSharp);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Managed Async Load Latency (ms)"), STAT_UnrealSharp_AsyncLoadLatency, STATGROUP_UnrealSharp);
+
+namespace
+{
+	// Loads that can still be cancelled from managed code, by request id.
+	TMap<int32, TSharedPtr<FStreamableHandle>> ActiveLoads;
+	FCriticalSection ActiveLoadsLock;
+	FThreadSafeCounter NextRequestId;
+}
 
 void UFSoftObjectPtrExporter::ExportFunctions(FRegisterExportedFunction RegisterExportedFunction)
 {
 	EXPORT_FUNCTION(LoadSynchronous)
+	EXPORT_FUNCTION(GetPath)
+	EXPORT_FUNCTION(LoadAsync)
+	EXPORT_FUNCTION(CancelAsyncLoad)
 }
 
 void* UFSoftObjectPtrExporter::LoadSynchronous(const TSoftObjectPtr<UObject>& SoftObjectPtr)
@@ -13,6 +30,92 @@ void* UFSoftObjectPtrExporter::LoadSynchronous(const TSoftObjectPtr<UObject>& So
 		return nullptr;
 	}
 	
-	UObject* Test = SoftObjectPtr.Get();
-	return FCSManager::Get().FindManagedObject(Test).GetIntPtr();
+	UObject* Object = SoftObjectPtr.LoadSynchronous();
+	return FCSManager::Get().FindManagedObject(Object).GetIntPtr();
+}
+
+void UFSoftObjectPtrExporter::GetPath(const TSoftObjectPtr<UObject>& SoftObjectPtr, FString& Path)
+{
+	Path = SoftObjectPtr.ToString();
+}
+
+int32 UFSoftObjectPtrExporter::LoadAsync(const FString* PathStrings, int32 NumPaths, int32 Priority, GCHandleIntPtr Callback, FManagedAsyncLoadCallback OnLoaded)
+{
+	check(IsInGameThread());
+	
+	TSharedRef<FScopedGCHandle> ManagedCallback = MakeShared<FScopedGCHandle>(Callback);
+
+	TArray<FSoftObjectPath> Paths;
+	Paths.Reserve(NumPaths);
+	
+	for (int32 Index = 0; Index < NumPaths; ++Index)
+	{
+		Paths.Emplace(PathStrings[Index]);
+	}
+
+	const int32 RequestId = NextRequestId.Increment();
+	const double StartTime = FPlatformTime::Seconds();
+	
+	auto OnLoadCompleted = [ManagedCallback, OnLoaded, Paths, RequestId, StartTime]()
+	{
+		{
+			FScopeLock Lock(&ActiveLoadsLock);
+			ActiveLoads.Remove(RequestId);
+		}
+		
+		DEC_DWORD_STAT(STAT_UnrealSharp_AsyncLoadsInFlight);
+		SET_FLOAT_STAT(STAT_UnrealSharp_AsyncLoadLatency, (FPlatformTime::Seconds() - StartTime) * 1000.0);
+		
+		// Resolve from the paths rather than the handle, so entries that failed to load keep their slot.
+		TArray<GCHandleIntPtr, TInlineAllocator<8>> LoadedObjects;
+		LoadedObjects.Reserve(Paths.Num());
+		
+		for (const FSoftObjectPath& Path : Paths)
+		{
+			UObject* LoadedObject = Path.ResolveObject();
+			LoadedObjects.Add(LoadedObject ? FCSManager::Get().FindManagedObject(LoadedObject).GetHandle() : GCHandleIntPtr());
+		}
+		
+		OnLoaded(ManagedCallback->Handle.GetHandle(), LoadedObjects.GetData(), LoadedObjects.Num());
+	};
+
+	INC_DWORD_STAT(STAT_UnrealSharp_AsyncLoadsInFlight);
+	
+	FStreamableManager& StreamableManager = UAssetManager::GetStreamableManager();
+	TSharedPtr<FStreamableHandle> Handle = StreamableManager.RequestAsyncLoad(Paths, FStreamableDelegate::CreateLambda(OnLoadCompleted), Priority);
+
+	if (!Handle.IsValid())
+	{
+		// Nothing valid to load, complete right away so the managed task doesn't hang.
+		OnLoadCompleted();
+		return 0;
+	}
+
+	if (Handle->HasLoadCompleted())
+	{
+		return 0;
+	}
+
+	FScopeLock Lock(&ActiveLoadsLock);
+	ActiveLoads.Add(RequestId, Handle);
+	return RequestId;
+}
+
+void UFSoftObjectPtrExporter::CancelAsyncLoad(int32 RequestId)
+{
+	check(IsInGameThread());
+	
+	TSharedPtr<FStreamableHandle> Handle;
+	{
+		FScopeLock Lock(&ActiveLoadsLock);
+		if (!ActiveLoads.RemoveAndCopyValue(RequestId, Handle))
+		{
+			return;
+		}
+	}
+
+	DEC_DWORD_STAT(STAT_UnrealSharp_AsyncLoadsInFlight);
+
+	// The completion delegate is dropped along with the handle, which releases the managed callback.
+	Handle->CancelHandle();
 }
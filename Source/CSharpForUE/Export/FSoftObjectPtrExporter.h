@@ -2,8 +2,12 @@
 
 #include "CoreMinimal.h"
 #include "FunctionsExporter.h"
+#include "CSharpForUE/CSManagedGCHandle.h"
 #include "FSoftObjectPtrExporter.generated.h"
 
+// Called on the game thread with the managed objects of a finished async load, in request order. Unloadable entries are null.
+using FManagedAsyncLoadCallback = void(STDCALL*)(GCHandleIntPtr, const GCHandleIntPtr*, int32);
+
 UCLASS(meta = (NotGeneratorValid))
 class CSHARPFORUE_API UFSoftObjectPtrExporter : public UFunctionsExporter
 {
@@ -19,4 +23,10 @@ private:
 	
 	static void* LoadSynchronous(const TSoftObjectPtr<UObject>& SoftObjectPtr);
 	
+	static void GetPath(const TSoftObjectPtr<UObject>& SoftObjectPtr, FString& Path);
+	
+	// Takes the paths as strings, the managed soft object pointers don't share the native layout.
+	static int32 LoadAsync(const FString* PathStrings, int32 NumPaths, int32 Priority, GCHandleIntPtr Callback, FManagedAsyncLoadCallback OnLoaded);
+	static void CancelAsyncLoad(int32 RequestId);
+	
 };
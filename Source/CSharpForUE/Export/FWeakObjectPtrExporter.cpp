@@ -1,7 +1,36 @@
 ﻿#include "FWeakObjectPtrExporter.h"
 
+#include "CSharpForUE/CSharpForUE.h"
 #include "CSharpForUE/CSManager.h"
 
+namespace
+{
+	// The serial number is read at its declared offset, check it against the accessor before trusting it.
+	bool CanReadSerialNumbersDirectly()
+	{
+		int32 NumChecked = 0;
+		for (int32 Index = 0; Index < GUObjectArray.GetObjectArrayNum() && NumChecked < 64; ++Index)
+		{
+			FUObjectItem* ObjectItem = GUObjectArray.IndexToObject(Index);
+
+			if (!ObjectItem || !ObjectItem->Object || ObjectItem->GetSerialNumber() == 0)
+			{
+				continue;
+			}
+
+			const int32 SerialNumber = *reinterpret_cast<const int32*>(reinterpret_cast<const uint8*>(ObjectItem) + STRUCT_OFFSET(FUObjectItem, SerialNumber));
+			if (SerialNumber != ObjectItem->GetSerialNumber())
+			{
+				return false;
+			}
+
+			++NumChecked;
+		}
+
+		return NumChecked > 0;
+	}
+}
+
 void UFWeakObjectPtrExporter::ExportFunctions(FRegisterExportedFunction RegisterExportedFunction)
 {
 	EXPORT_FUNCTION(SetObject)
@@ -9,6 +38,8 @@ void UFWeakObjectPtrExporter::ExportFunctions(FRegisterExportedFunction Register
 	EXPORT_FUNCTION(IsValid)
 	EXPORT_FUNCTION(IsStale)
 	EXPORT_FUNCTION(NativeEquals)
+	EXPORT_FUNCTION(GetObjectArrayLayout)
+	EXPORT_FUNCTION(GetObjectItemChunk)
 }
 
 void UFWeakObjectPtrExporter::SetObject(TWeakObjectPtr<UObject>& WeakObject, UObject* Object)
@@ -42,4 +73,30 @@ bool UFWeakObjectPtrExporter::NativeEquals(TWeakObjectPtr<UObject> A, TWeakObjec
 	return A == B;
 }
 
+bool UFWeakObjectPtrExporter::GetObjectArrayLayout(FCSObjectArrayLayout& OutLayout)
+{
+	const int32 FlagsOffset = FCSManager::GetObjectItemFlagsOffset();
+	
+	if (FlagsOffset == INDEX_NONE || !CanReadSerialNumbersDirectly())
+	{
+		UE_LOG(LogUnrealSharp, Warning, TEXT("Unexpected object array layout, managed weak object pointers will call into native."));
+		return false;
+	}
+
+	OutLayout.ItemSize = sizeof(FUObjectItem);
+	OutLayout.SerialNumberOffset = STRUCT_OFFSET(FUObjectItem, SerialNumber);
+	OutLayout.FlagsOffset = FlagsOffset;
+	OutLayout.InvalidFlags = static_cast<int32>(EInternalObjectFlags::Unreachable | EInternalObjectFlags::Garbage);
+	OutLayout.ElementsPerChunk = FChunkedFixedUObjectArray::NumElementsPerChunk;
+	OutLayout.MaxChunks = FMath::DivideAndRoundUp(GUObjectArray.GetObjectArrayCapacity(), static_cast<int32>(FChunkedFixedUObjectArray::NumElementsPerChunk));
+	return true;
+}
+
+void* UFWeakObjectPtrExporter::GetObjectItemChunk(int32 ChunkIndex)
+{
+	// Chunks are allocated as the array grows and never move or get freed, so managed code keeps the pointer.
+	// The first item of an allocated chunk is always below the element count.
+	return GUObjectArray.IndexToObject(ChunkIndex * FChunkedFixedUObjectArray::NumElementsPerChunk);
+}
+
 
@@ -6,6 +6,17 @@
 #include "FunctionsExporter.h"
 #include "FWeakObjectPtrExporter.generated.h"
 
+// Where managed code finds what it needs to resolve weak object pointers in GUObjectArray by itself.
+struct FCSObjectArrayLayout
+{
+	int32 ItemSize;
+	int32 SerialNumberOffset;
+	int32 FlagsOffset;
+	int32 InvalidFlags;
+	int32 ElementsPerChunk;
+	int32 MaxChunks;
+};
+
 UCLASS(meta = (NotGeneratorValid))
 class CSHARPFORUE_API UFWeakObjectPtrExporter : public UFunctionsExporter
 {
@@ -24,5 +35,8 @@ private:
 	static bool IsValid(TWeakObjectPtr<UObject> WeakObjectPtr);
 	static bool IsStale(TWeakObjectPtr<UObject> WeakObjectPtr);
 	static bool NativeEquals(TWeakObjectPtr<UObject> A, TWeakObjectPtr<UObject> B);
+
+	static bool GetObjectArrayLayout(FCSObjectArrayLayout& OutLayout);
+	static void* GetObjectItemChunk(int32 ChunkIndex);
 };
 
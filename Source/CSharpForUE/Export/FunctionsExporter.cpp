@@ -1,20 +1,61 @@
 ﻿#include "FunctionsExporter.h"
-#include "UObject/UObjectIterator.h"
+#include "UObject/UObjectHash.h"
 #include "TimerManager.h"
+#include "CSharpForUE/CSharpForUE.h"
+#include "CSharpForUE/CSStartupTimings.h"
 
-void UFunctionsExporter::StartExportingAPI(FRegisterExportedFunction RegisterExportedFunction)
+namespace
 {
+	// Only set while StartExportingAPI collects the exports, RegisterExportedFunction can't capture.
+	TMap<FString, void*>* ExportedFunctions = nullptr;
+
+	void RegisterExportedFunction(void* FunctionPointer, const TCHAR* FunctionName)
+	{
+		ExportedFunctions->Add(FunctionName, FunctionPointer);
+	}
+}
+
+int32 UFunctionsExporter::StartExportingAPI(const TCHAR* FunctionNames, int32 NumFunctions, void** OutFunctions)
+{
+	CS_STARTUP_PHASE(TEXT("ExportFunctions"));
+
+	TMap<FString, void*> Functions;
+	ExportedFunctions = &Functions;
+	
 	// CDOs hasn't been created yet. We need to look through the classes instead.
-	for (TObjectIterator<UClass> It; It; ++It)
+	TArray<UClass*> ExporterClasses;
+	GetDerivedClasses(StaticClass(), ExporterClasses);
+	
+	for (UClass* ClassObject : ExporterClasses)
 	{
-		UClass* ClassObject = *It;
-		
-		if (!ClassObject->IsChildOf(StaticClass()) || ClassObject->HasAnyClassFlags(CLASS_Abstract))
+		if (ClassObject->HasAnyClassFlags(CLASS_Abstract))
 		{
 			continue;
 		}
 		
 		UFunctionsExporter* FunctionsExporter = ClassObject->GetDefaultObject<UFunctionsExporter>();
-		FunctionsExporter->ExportFunctions(RegisterExportedFunction);
+		FunctionsExporter->ExportFunctions(&RegisterExportedFunction);
+	}
+
+	ExportedFunctions = nullptr;
+
+	// Managed code lists its function pointer fields by ordinal, fill them in the same order.
+	int32 NumMissingFunctions = 0;
+	const TCHAR* FunctionName = FunctionNames;
+	
+	for (int32 Index = 0; Index < NumFunctions; ++Index)
+	{
+		void** FoundFunction = Functions.Find(FunctionName);
+		OutFunctions[Index] = FoundFunction ? *FoundFunction : nullptr;
+
+		if (!FoundFunction)
+		{
+			UE_LOG(LogUnrealSharp, Error, TEXT("Managed code expects native function %s, but it isn't exported."), FunctionName);
+			++NumMissingFunctions;
+		}
+
+		FunctionName += FCString::Strlen(FunctionName) + 1;
 	}
+	
+	return NumMissingFunctions;
 }
@@ -2,11 +2,20 @@
 
 #include "CoreMinimal.h"
 #include "UObject/Object.h"
+#include "CSharpForUE/CSInteropStats.h"
 #include "FunctionsExporter.generated.h"
 
 using FRegisterExportedFunction = void(*)(void*, const TCHAR*);
 
+#if WITH_CSHARP_INTEROP_STATS
+#define EXPORT_FUNCTION(FunctionName) \
+	{ \
+		const FString ExportedFunctionName = GetClass()->GetName() + "." + #FunctionName; \
+		RegisterExportedFunction(GetExportedFunctionPointer<&FunctionName>(ExportedFunctionName), *ExportedFunctionName); \
+	}
+#else
 #define EXPORT_FUNCTION(FunctionName) RegisterExportedFunction(&FunctionName, *(GetClass()->GetName() + "." + #FunctionName));
+#endif
 
 UCLASS(Abstract, NotBlueprintable, NotBlueprintType, meta = (NotGeneratorValid))
 class CSHARPFORUE_API UFunctionsExporter : public UObject
@@ -19,6 +28,8 @@ public:
 	virtual void ExportFunctions(FRegisterExportedFunction RegisterExportedFunction) { PURE_VIRTUAL() }
 	// End
 	
-	static void StartExportingAPI(FRegisterExportedFunction RegisterExportedFunction);
+	// Fills OutFunctions with the exported functions named in FunctionNames, a block of NumFunctions null terminated names.
+	// Returns how many of them aren't exported. Those are left null.
+	static int32 StartExportingAPI(const TCHAR* FunctionNames, int32 NumFunctions, void** OutFunctions);
 	
 };
@@ -6,6 +6,7 @@ void UUCoreUObjectExporter::ExportFunctions(FRegisterExportedFunction RegisterEx
 {
 	EXPORT_FUNCTION(GetNativeClassFromName)
 	EXPORT_FUNCTION(GetNativeStructFromName)
+	EXPORT_FUNCTION(GetTypeCacheGeneration)
 }
 
 UClass* UUCoreUObjectExporter::GetNativeClassFromName(const char* InClassName)
@@ -18,3 +19,8 @@ UStruct* UUCoreUObjectExporter::GetNativeStructFromName(const char* InStructName
 {
 	return FCSTypeRegistry::GetStructFromName(InStructName);
 }
+
+const int32* UUCoreUObjectExporter::GetTypeCacheGeneration()
+{
+	return FCSTypeRegistry::Get().GetTypeCacheGeneration();
+}
@@ -21,4 +21,5 @@ private:
 
 	static UClass* GetNativeClassFromName(const char* InClassName);
 	static UStruct* GetNativeStructFromName(const char* InStructName);
+	static const int32* GetTypeCacheGeneration();
 };
@@ -4,6 +4,7 @@
 void UUEnhancedInputComponentExporter::ExportFunctions(FRegisterExportedFunction RegisterExportedFunction)
 {
 	EXPORT_FUNCTION(BindAction)
+	EXPORT_FUNCTION(BindManagedAction)
 }
 
 void UUEnhancedInputComponentExporter::BindAction(UEnhancedInputComponent* InputComponent, UInputAction* InputAction, ETriggerEvent TriggerEvent, UObject* Object, const FName FunctionName)
@@ -15,3 +16,18 @@ void UUEnhancedInputComponentExporter::BindAction(UEnhancedInputComponent* Input
 	
 	InputComponent->BindAction(InputAction, TriggerEvent, Object, FunctionName);
 }
+
+void UUEnhancedInputComponentExporter::BindManagedAction(UEnhancedInputComponent* InputComponent, UInputAction* InputAction, ETriggerEvent TriggerEvent, GCHandleIntPtr Callback, FManagedInputActionValueCallback Invoke)
+{
+	TSharedRef<FScopedGCHandle> ManagedCallback = MakeShared<FScopedGCHandle>(Callback);
+	
+	if (!IsValid(InputComponent) || !IsValid(InputAction))
+	{
+		return;
+	}
+
+	InputComponent->BindActionValueLambda(InputAction, TriggerEvent, [ManagedCallback, Invoke](const FInputActionValue& Value)
+	{
+		Invoke(ManagedCallback->Handle.GetHandle(), &Value);
+	});
+}
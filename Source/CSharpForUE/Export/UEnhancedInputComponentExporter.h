@@ -2,12 +2,16 @@
 
 #include "CoreMinimal.h"
 #include "FunctionsExporter.h"
+#include "CSharpForUE/CSManagedGCHandle.h"
 #include "UEnhancedInputComponentExporter.generated.h"
 
 enum class ETriggerEvent : uint8;
 
 class UInputAction;
 class UEnhancedInputComponent;
+struct FInputActionValue;
+
+using FManagedInputActionValueCallback = void(STDCALL*)(GCHandleIntPtr, const FInputActionValue*);
 
 UCLASS(meta = (NotGeneratorValid))
 class CSHARPFORUE_API UUEnhancedInputComponentExporter : public UFunctionsExporter
@@ -23,5 +27,6 @@ public:
 private:
 
 	static void BindAction(UEnhancedInputComponent* InputComponent, UInputAction* InputAction, ETriggerEvent TriggerEvent, UObject* Object, const FName FunctionName);
+	static void BindManagedAction(UEnhancedInputComponent* InputComponent, UInputAction* InputAction, ETriggerEvent TriggerEvent, GCHandleIntPtr Callback, FManagedInputActionValueCallback Invoke);
 	
 };
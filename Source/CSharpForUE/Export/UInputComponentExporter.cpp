@@ -1,10 +1,49 @@
 ﻿#include "UInputComponentExporter.h"
+#include "Engine/World.h"
+
+namespace
+{
+	struct FPendingAxisValue
+	{
+		TSharedRef<FScopedGCHandle> Callback;
+		float Value;
+	};
+
+	// Axis values from batched bindings, delivered to managed code in one call when the world tick ends.
+	TArray<FPendingAxisValue> PendingAxisValues;
+	FManagedInputAxisBatchCallback InvokeAxisBatch = nullptr;
+	FDelegateHandle FlushAxisValuesHandle;
+
+	void FlushAxisValues(UWorld* World, ELevelTick TickType, float DeltaSeconds)
+	{
+		if (PendingAxisValues.IsEmpty() || !InvokeAxisBatch)
+		{
+			return;
+		}
+
+		TArray<FPendingAxisValue> AxisValues = MoveTemp(PendingAxisValues);
+
+		TArray<FManagedAxisValue, TInlineAllocator<32>> ManagedAxisValues;
+		ManagedAxisValues.Reserve(AxisValues.Num());
+		
+		for (const FPendingAxisValue& AxisValue : AxisValues)
+		{
+			ManagedAxisValues.Add({ AxisValue.Callback->Handle.GetHandle(), AxisValue.Value });
+		}
+
+		InvokeAxisBatch(ManagedAxisValues.GetData(), ManagedAxisValues.Num());
+	}
+}
 
 void UUInputComponentExporter::ExportFunctions(FRegisterExportedFunction RegisterExportedFunction)
 {
 	EXPORT_FUNCTION(BindAction)
 	EXPORT_FUNCTION(BindActionKeySignature)
 	EXPORT_FUNCTION(BindAxis)
+	EXPORT_FUNCTION(BindManagedAction)
+	EXPORT_FUNCTION(BindManagedActionKeySignature)
+	EXPORT_FUNCTION(BindManagedAxis)
+	EXPORT_FUNCTION(BindManagedAxisBatched)
 }
 
 void UUInputComponentExporter::BindAction(UInputComponent* InputComponent, const FName ActionName, const EInputEvent KeyEvent, UObject* Object, const FName FunctionName, bool bConsumeInput, bool bExecuteWhenPaused)
@@ -56,3 +95,89 @@ void UUInputComponentExporter::BindAxis(UInputComponent* InputComponent, const F
 	NewAxisBinding.AxisDelegate.BindDelegate(Object, FunctionName);
 	InputComponent->AxisBindings.Add(NewAxisBinding);
 }
+
+void UUInputComponentExporter::BindManagedAction(UInputComponent* InputComponent, const FName ActionName, const EInputEvent KeyEvent, GCHandleIntPtr Callback, FManagedInputActionCallback Invoke, bool bConsumeInput, bool bExecuteWhenPaused)
+{
+	TSharedRef<FScopedGCHandle> ManagedCallback = MakeShared<FScopedGCHandle>(Callback);
+	
+	if (!IsValid(InputComponent))
+	{
+		return;
+	}
+
+	FInputActionBinding Binding(ActionName, KeyEvent);
+	Binding.ActionDelegate.BindDelegate(FInputActionHandlerSignature::CreateLambda([ManagedCallback, Invoke]()
+	{
+		Invoke(ManagedCallback->Handle.GetHandle());
+	}));
+	Binding.bConsumeInput = bConsumeInput;
+	Binding.bExecuteWhenPaused = bExecuteWhenPaused;
+	
+	InputComponent->AddActionBinding(Binding);
+}
+
+void UUInputComponentExporter::BindManagedActionKeySignature(UInputComponent* InputComponent, const FName ActionName, const EInputEvent KeyEvent, GCHandleIntPtr Callback, FManagedInputKeyCallback Invoke, bool bConsumeInput, bool bExecuteWhenPaused)
+{
+	TSharedRef<FScopedGCHandle> ManagedCallback = MakeShared<FScopedGCHandle>(Callback);
+	
+	if (!IsValid(InputComponent))
+	{
+		return;
+	}
+
+	FInputActionBinding Binding(ActionName, KeyEvent);
+	Binding.ActionDelegate.BindDelegate(FInputActionHandlerWithKeySignature::CreateLambda([ManagedCallback, Invoke](FKey Key)
+	{
+		Invoke(ManagedCallback->Handle.GetHandle(), &Key);
+	}));
+	Binding.bConsumeInput = bConsumeInput;
+	Binding.bExecuteWhenPaused = bExecuteWhenPaused;
+	
+	InputComponent->AddActionBinding(Binding);
+}
+
+void UUInputComponentExporter::BindManagedAxis(UInputComponent* InputComponent, const FName AxisName, GCHandleIntPtr Callback, FManagedInputAxisCallback Invoke, bool bConsumeInput, bool bExecuteWhenPaused)
+{
+	TSharedRef<FScopedGCHandle> ManagedCallback = MakeShared<FScopedGCHandle>(Callback);
+	
+	if (!IsValid(InputComponent))
+	{
+		return;
+	}
+
+	FInputAxisBinding NewAxisBinding(AxisName);
+	NewAxisBinding.bConsumeInput = bConsumeInput;
+	NewAxisBinding.bExecuteWhenPaused = bExecuteWhenPaused;
+	NewAxisBinding.AxisDelegate.BindDelegate(FInputAxisHandlerSignature::CreateLambda([ManagedCallback, Invoke](float Value)
+	{
+		Invoke(ManagedCallback->Handle.GetHandle(), Value);
+	}));
+	InputComponent->AxisBindings.Add(NewAxisBinding);
+}
+
+void UUInputComponentExporter::BindManagedAxisBatched(UInputComponent* InputComponent, const FName AxisName, GCHandleIntPtr Callback, FManagedInputAxisBatchCallback InvokeBatch, bool bConsumeInput, bool bExecuteWhenPaused)
+{
+	TSharedRef<FScopedGCHandle> ManagedCallback = MakeShared<FScopedGCHandle>(Callback);
+	
+	if (!IsValid(InputComponent))
+	{
+		return;
+	}
+
+	// Every batched binding passes the same managed entry point.
+	InvokeAxisBatch = InvokeBatch;
+
+	if (!FlushAxisValuesHandle.IsValid())
+	{
+		FlushAxisValuesHandle = FWorldDelegates::OnWorldTickEnd.AddStatic(&FlushAxisValues);
+	}
+
+	FInputAxisBinding NewAxisBinding(AxisName);
+	NewAxisBinding.bConsumeInput = bConsumeInput;
+	NewAxisBinding.bExecuteWhenPaused = bExecuteWhenPaused;
+	NewAxisBinding.AxisDelegate.BindDelegate(FInputAxisHandlerSignature::CreateLambda([ManagedCallback](float Value)
+	{
+		PendingAxisValues.Add({ ManagedCallback, Value });
+	}));
+	InputComponent->AxisBindings.Add(NewAxisBinding);
+}
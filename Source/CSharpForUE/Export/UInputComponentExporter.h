@@ -3,10 +3,23 @@
 #include "CoreMinimal.h"
 #include "FunctionsExporter.h"
 #include "InputAction.h"
+#include "CSharpForUE/CSManagedGCHandle.h"
 #include "UInputComponentExporter.generated.h"
 
 class UInputAction;
 
+// A managed axis callback and the value it fired with, delivered in batches.
+struct FManagedAxisValue
+{
+	GCHandleIntPtr Callback;
+	float Value;
+};
+
+using FManagedInputActionCallback = void(STDCALL*)(GCHandleIntPtr);
+using FManagedInputKeyCallback = void(STDCALL*)(GCHandleIntPtr, const FKey*);
+using FManagedInputAxisCallback = void(STDCALL*)(GCHandleIntPtr, float);
+using FManagedInputAxisBatchCallback = void(STDCALL*)(const FManagedAxisValue*, int32);
+
 UCLASS()
 class CSHARPFORUE_API UUInputComponentExporter : public UFunctionsExporter
 {
@@ -23,5 +36,10 @@ private:
 	static void BindAction(UInputComponent* InputComponent, const FName ActionName, const EInputEvent KeyEvent, UObject* Object, const FName FunctionName, bool bConsumeInput, bool bExecuteWhenPaused);
 	static void BindActionKeySignature(UInputComponent* InputComponent, const FName ActionName, const EInputEvent KeyEvent, UObject* Object, const FName FunctionName, bool bConsumeInput, bool bExecuteWhenPaused);
 	static void BindAxis(UInputComponent* InputComponent, const FName AxisName, UObject* Object, const FName FunctionName, bool bConsumeInput, bool bExecuteWhenPaused);
+
+	static void BindManagedAction(UInputComponent* InputComponent, const FName ActionName, const EInputEvent KeyEvent, GCHandleIntPtr Callback, FManagedInputActionCallback Invoke, bool bConsumeInput, bool bExecuteWhenPaused);
+	static void BindManagedActionKeySignature(UInputComponent* InputComponent, const FName ActionName, const EInputEvent KeyEvent, GCHandleIntPtr Callback, FManagedInputKeyCallback Invoke, bool bConsumeInput, bool bExecuteWhenPaused);
+	static void BindManagedAxis(UInputComponent* InputComponent, const FName AxisName, GCHandleIntPtr Callback, FManagedInputAxisCallback Invoke, bool bConsumeInput, bool bExecuteWhenPaused);
+	static void BindManagedAxisBatched(UInputComponent* InputComponent, const FName AxisName, GCHandleIntPtr Callback, FManagedInputAxisBatchCallback InvokeBatch, bool bConsumeInput, bool bExecuteWhenPaused);
 	
 };
@@ -9,6 +9,7 @@ void UUObjectExporter::ExportFunctions(FRegisterExportedFunction RegisterExporte
 	EXPORT_FUNCTION(InvokeNativeStaticFunction);
 	EXPORT_FUNCTION(InvokeNativeFunction);
 	EXPORT_FUNCTION(NativeIsValid)
+	EXPORT_FUNCTION(GetGarbageFlag)
 }
 
 void* UUObjectExporter::CreateNewObject(UObject* Outer, UClass* Class, UObject* Template)
@@ -108,3 +109,8 @@ bool UUObjectExporter::NativeIsValid(UObject* Object)
 {
 	return IsValid(Object);
 }
+
+int32 UUObjectExporter::GetGarbageFlag()
+{
+	return static_cast<int32>(EInternalObjectFlags::Garbage);
+}
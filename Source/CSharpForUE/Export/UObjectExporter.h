@@ -25,4 +25,5 @@ private:
 	static void InvokeNativeFunction(UObject* NativeObject, UFunction* NativeFunction, uint8* Params);
 	static void InvokeNativeStaticFunction(const UClass* NativeClass, UFunction* NativeFunction, uint8* Params);
 	static bool NativeIsValid(UObject* Object);
+	static int32 GetGarbageFlag();
 };
@@ -1,11 +1,66 @@
 ﻿#include "UWorldExporter.h"
+#include "CSharpForUE/CSharpForUE.h"
+#include "CSharpForUE/CSDeveloperSettings.h"
 #include "CSharpForUE/CSManager.h"
+#include "CSharpForUE/CSManagedStats.h"
 #include "Kismet/KismetSystemLibrary.h"
 
+namespace
+{
+	// Managed timers that fired during the current world tick. They are invoked together when the tick ends.
+	// The callbacks are shared with the timers' delegates, so they're freed once a timer is gone and its last call has run.
+	TArray<TSharedRef<FScopedGCHandle>> PendingManagedTimers;
+	FDelegateHandle FlushManagedTimersHandle;
+
+	void FlushManagedTimers(UWorld* World, ELevelTick TickType, float DeltaSeconds)
+	{
+		if (PendingManagedTimers.IsEmpty())
+		{
+			return;
+		}
+
+		// Callbacks may set new timers, which can't fire before the next tick anyway.
+		TArray<TSharedRef<FScopedGCHandle>> FiredTimers = MoveTemp(PendingManagedTimers);
+
+		TArray<GCHandleIntPtr, TInlineAllocator<64>> Callbacks;
+		Callbacks.Reserve(FiredTimers.Num());
+		
+		for (const TSharedRef<FScopedGCHandle>& FiredTimer : FiredTimers)
+		{
+			Callbacks.Add(FiredTimer->Handle.GetHandle());
+		}
+
+		FString ExceptionMessage;
+		int32 NumFailed;
+		{
+#if WITH_CSHARP_MANAGED_STATS
+			FCSScopedManagedTime ManagedTime;
+#endif
+			NumFailed = FCSManagedCallbacks::ManagedCallbacks.InvokeTimerCallbacks(Callbacks.GetData(), Callbacks.Num(), &ExceptionMessage);
+		}
+
+		if (NumFailed == 0)
+		{
+			return;
+		}
+
+		// Timers have no script frame to throw into, so the exceptions go straight to the log.
+		if (GetDefault<UCSDeveloperSettings>()->bCrashOnException)
+		{
+			UE_LOG(LogUnrealSharp, Fatal, TEXT("%d managed timer callbacks threw:\n%s"), NumFailed, *ExceptionMessage);
+		}
+		else
+		{
+			UE_LOG(LogUnrealSharp, Error, TEXT("%d managed timer callbacks threw:\n%s"), NumFailed, *ExceptionMessage);
+		}
+	}
+}
+
 void UUWorldExporter::ExportFunctions(FRegisterExportedFunction RegisterExportedFunction)
 {
 	EXPORT_FUNCTION(SpawnActor)
 	EXPORT_FUNCTION(SetTimer)
+	EXPORT_FUNCTION(SetManagedTimer)
 	EXPORT_FUNCTION(InvalidateTimer)
 	EXPORT_FUNCTION(GetWorldSubsystem)
 }
@@ -41,6 +96,33 @@ void UUWorldExporter::SetTimer(UObject* Object, FName FunctionName, float Rate,
 	*TimerHandle = UKismetSystemLibrary::K2_SetTimerDelegate(Delegate, Rate, Loop, false, InitialDelay);
 }
 
+void UUWorldExporter::SetManagedTimer(UObject* WorldContextObject, GCHandleIntPtr Callback, float Rate, bool Loop, float InitialDelay, FTimerHandle* TimerHandle)
+{
+	TSharedRef<FScopedGCHandle> TimerCallback = MakeShared<FScopedGCHandle>(Callback);
+
+	UWorld* World = IsValid(WorldContextObject) ? WorldContextObject->GetWorld() : nullptr;
+	
+	if (!World)
+	{
+		*TimerHandle = FTimerHandle();
+		return;
+	}
+
+	if (!FlushManagedTimersHandle.IsValid())
+	{
+		FlushManagedTimersHandle = FWorldDelegates::OnWorldTickEnd.AddStatic(&FlushManagedTimers);
+	}
+
+	FTimerDelegate Delegate = FTimerDelegate::CreateWeakLambda(WorldContextObject, [TimerCallback]()
+	{
+		PendingManagedTimers.Add(TimerCallback);
+	});
+
+	// Same first delay as K2_SetTimerDelegate.
+	const float FirstDelay = Rate + FMath::Max(0.f, InitialDelay);
+	World->GetTimerManager().SetTimer(*TimerHandle, Delegate, Rate, Loop, FirstDelay);
+}
+
 void UUWorldExporter::InvalidateTimer(UObject* Object, FTimerHandle* TimerHandle)
 {
 	if (!IsValid(Object))
@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "FunctionsExporter.h"
+#include "CSharpForUE/CSManagedGCHandle.h"
 #include "UWorldExporter.generated.h"
 
 struct FSpawnActorParameters_Interop
@@ -30,6 +31,7 @@ private:
 
 	static void* SpawnActor(const UObject* Outer, const FTransform* SpawnTransform, UClass* Class, const FSpawnActorParameters_Interop* ManagedSpawnedParameters);
 	static void SetTimer(UObject* Object, FName FunctionName, float Rate, bool Loop, float InitialDelay, FTimerHandle* TimerHandle);
+	static void SetManagedTimer(UObject* WorldContextObject, GCHandleIntPtr Callback, float Rate, bool Loop, float InitialDelay, FTimerHandle* TimerHandle);
 	static void InvalidateTimer(UObject* Object, FTimerHandle* TimerHandle);
 	static void* GetWorldSubsystem(UClass* SubsystemClass, UObject* WorldContextObject);
 };
@@ -0,0 +1,154 @@
+﻿#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "CSTestActor.h"
+#include "CSharpForUE/CSManager.h"
+#include "CSharpForUE/CSManagedDelegateTarget.h"
+#include "CSProcHelper.h"
+#include "UObject/Package.h"
+
+namespace
+{
+	struct FCSReceivedParameters
+	{
+		int32 Calls = 0;
+		int32 MyInteger = 0;
+		FString MyString;
+	};
+
+	FCSReceivedParameters Received;
+	UFunction* TestSignature = nullptr;
+
+	// Matches DelegateUnloadRequest in ManagedDelegateTests.cs.
+	struct FCSDelegateUnloadRequest
+	{
+		FMulticastDelegateProperty* DelegateProperty = nullptr;
+		void* DelegateAddress = nullptr;
+		int32 Calls = 0;
+		bool bReloadingEnabled = false;
+		bool bCollected = false;
+	};
+
+	// Stands in for the generated managed invoker, reading the parameters at the signature's offsets.
+	int32 RecordParameters(GCHandleIntPtr Handler, void* Parameters, FString* ExceptionMessage)
+	{
+		++Received.Calls;
+		Received.MyInteger = *CastFieldChecked<FIntProperty>(TestSignature->FindPropertyByName(TEXT("MyInteger")))->ContainerPtrToValuePtr<int32>(Parameters);
+		Received.MyString = *CastFieldChecked<FStrProperty>(TestSignature->FindPropertyByName(TEXT("MyString")))->ContainerPtrToValuePtr<FString>(Parameters);
+		return 0;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCSManagedDelegateTargetBroadcastTest, "UnrealSharp.ManagedDelegateTarget.BroadcastWithParameters", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FCSManagedDelegateTargetBroadcastTest::RunTest(const FString& Parameters)
+{
+	ACSTestActor* Actor = NewObject<ACSTestActor>(GetTransientPackage());
+	FMulticastDelegateProperty* DelegateProperty = FindFProperty<FMulticastDelegateProperty>(ACSTestActor::StaticClass(), GET_MEMBER_NAME_CHECKED(ACSTestActor, MyTestDelegate));
+
+	if (!TestNotNull(TEXT("MyTestDelegate property"), DelegateProperty))
+	{
+		return false;
+	}
+
+	Received = FCSReceivedParameters();
+	TestSignature = DelegateProperty->SignatureFunction;
+
+	// A null handler, the stand-in invoker doesn't need one and releasing it is then a no-op.
+	UCSManagedDelegateTarget* Target = UCSManagedDelegateTarget::Create(Actor, GCHandleIntPtr(), &RecordParameters, TestSignature);
+
+	FScriptDelegate ScriptDelegate;
+	ScriptDelegate.BindUFunction(Target, UCSManagedDelegateTarget::GetInvokeFunctionName());
+	Actor->MyTestDelegate.Add(ScriptDelegate);
+
+	Actor->MyTestDelegate.Broadcast(42, TEXT("UnrealSharp"));
+
+	TestEqual(TEXT("Handler calls"), Received.Calls, 1);
+	TestEqual(TEXT("MyInteger"), Received.MyInteger, 42);
+	TestEqual(TEXT("MyString"), Received.MyString, FString(TEXT("UnrealSharp")));
+
+	// Released targets are skipped by broadcasts still bound to them.
+	Target->Release();
+	Actor->MyTestDelegate.Broadcast(7, TEXT("Released"));
+	TestEqual(TEXT("Handler calls after release"), Received.Calls, 1);
+
+	Actor->MyTestDelegate.Clear();
+	Actor->MarkAsGarbage();
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCSManagedDelegateTargetUnloadTest, "UnrealSharp.ManagedDelegateTarget.UnloadWhileBound", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FCSManagedDelegateTargetUnloadTest::RunTest(const FString& Parameters)
+{
+	FCSManager& Manager = FCSManager::Get();
+	const FString AssemblyName = FCSProcHelper::GetUserManagedProjectName();
+
+	if (!Manager.LoadedPlugins.Contains(*AssemblyName))
+	{
+		AddError(FString::Printf(TEXT("The managed assembly %s isn't loaded, there's nothing to bind from."), *AssemblyName));
+		return false;
+	}
+
+	// The managed half lives in the UnrealSharp assembly, which type lookups fall back to.
+	uint8* TypeHandle = Manager.GetTypeHandle(AssemblyName, TEXT("UnrealSharp.Tests"), TEXT("ManagedDelegateTests"));
+	void* BindInCollectibleContext = FCSManagedCallbacks::ManagedCallbacks.LookupManagedMethod(TypeHandle, TEXT("BindInCollectibleContext"));
+	void* UnloadCollectibleContext = FCSManagedCallbacks::ManagedCallbacks.LookupManagedMethod(TypeHandle, TEXT("UnloadCollectibleContext"));
+
+	if (!BindInCollectibleContext || !UnloadCollectibleContext)
+	{
+		AddError(TEXT("Couldn't find the managed half of the test."));
+		return false;
+	}
+
+	const GCHandleIntPtr TargetHandle = Manager.FindManagedObject(GetTransientPackage()).GetHandle();
+	ACSTestActor* Actor = NewObject<ACSTestActor>(GetTransientPackage());
+
+	FCSDelegateUnloadRequest Request;
+	Request.DelegateProperty = FindFProperty<FMulticastDelegateProperty>(ACSTestActor::StaticClass(), GET_MEMBER_NAME_CHECKED(ACSTestActor, MyTestDelegate));
+	Request.DelegateAddress = &Actor->MyTestDelegate;
+
+	FString ExceptionMessage;
+	if (FCSManagedCallbacks::ManagedCallbacks.InvokeManagedMethod(TargetHandle, BindInCollectibleContext, &Request, nullptr, &ExceptionMessage) != 0)
+	{
+		AddError(ExceptionMessage);
+		return false;
+	}
+
+	if (!Request.bReloadingEnabled)
+	{
+		AddInfo(TEXT("Assembly reloading is disabled, handlers are never released by an unload."));
+		Actor->MarkAsGarbage();
+		return true;
+	}
+
+	Actor->MyTestDelegate.Broadcast(42, TEXT("UnrealSharp"));
+
+	// The actor outlives the unload, so only the handle being released lets the context go.
+	if (FCSManagedCallbacks::ManagedCallbacks.InvokeManagedMethod(TargetHandle, UnloadCollectibleContext, &Request, nullptr, &ExceptionMessage) != 0)
+	{
+		AddError(ExceptionMessage);
+		return false;
+	}
+
+	TestEqual(TEXT("Handler calls before unloading"), Request.Calls, 1);
+	TestTrue(TEXT("Unloaded context was collected"), Request.bCollected);
+
+	// Still bound, with an empty handle.
+	Actor->MyTestDelegate.Broadcast(7, TEXT("Unloaded"));
+
+	for (UObject* Object : Actor->MyTestDelegate.GetAllObjects())
+	{
+		if (UCSManagedDelegateTarget* Target = Cast<UCSManagedDelegateTarget>(Object))
+		{
+			Target->Release();
+		}
+	}
+
+	Actor->MyTestDelegate.Clear();
+	Actor->MarkAsGarbage();
+	return true;
+}
+
+#endif
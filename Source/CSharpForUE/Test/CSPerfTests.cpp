@@ -0,0 +1,312 @@
+﻿#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "CSTestActor.h"
+#include "CSharpForUE/CSharpForUE.h"
+#include "CSharpForUE/CSManager.h"
+#include "CSharpForUE/CSManagedGCHandle.h"
+#include "CSProcHelper.h"
+#include "Dom/JsonObject.h"
+#include "Misc/EngineVersion.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonSerializer.h"
+#include "UObject/Package.h"
+
+// Benchmarks the cost of crossing between native and managed code, one automation test per benchmark.
+// Runs headless with: -nullrhi -unattended -ExecCmds="Automation RunTests UnrealSharp.Perf; Quit"
+// Results are written as JSON to the profiling directory, or to the path given with -UnrealSharpPerfReport=.
+// -UnrealSharpPerfIterations= changes how many times each operation is repeated.
+
+namespace
+{
+	// Matches BenchmarkRequest in InteropBenchmarks.cs.
+	struct FCSBenchmarkRequest
+	{
+		const TCHAR* Name = nullptr;
+		int32 Iterations = 0;
+		UObject* Object = nullptr;
+		FArrayProperty* ArrayProperty = nullptr;
+		void* ArrayAddress = nullptr;
+		FMapProperty* MapProperty = nullptr;
+		void* MapAddress = nullptr;
+		double NanosecondsPerOp = 0.0;
+		GCHandleIntPtr DelegateHandle;
+		FMulticastDelegateProperty* DelegateProperty = nullptr;
+		void* DelegateAddress = nullptr;
+	};
+
+	// Timed in managed code, by InteropBenchmarks.RunBenchmark.
+	const TCHAR* ManagedBenchmarks[] =
+	{
+		TEXT("Call.NoArguments"),
+		TEXT("Call.Pointer"),
+		TEXT("Call.Struct"),
+		TEXT("Marshal.Object"),
+		TEXT("Marshal.String"),
+		TEXT("Array.Read"),
+		TEXT("Array.Write"),
+		TEXT("Map.Read"),
+		TEXT("WeakObject.Get"),
+		TEXT("WeakObject.GetNative"),
+		TEXT("WeakObject.IsValid"),
+		TEXT("WeakObject.IsValidNative"),
+	};
+
+	// Timed here.
+	const TCHAR* NativeBenchmarks[] =
+	{
+		TEXT("InvokeManagedMethod"),
+		TEXT("Delegate.Invoke"),
+		TEXT("Delegate.Broadcast"),
+		TEXT("Wrapper.Create"),
+		TEXT("GC.Delete"),
+	};
+
+	const int32 ContainerSize = 64;
+
+	TMap<FString, double> Results;
+
+	int32 GetIterations()
+	{
+		int32 Iterations = 100000;
+		FParse::Value(FCommandLine::Get(), TEXT("UnrealSharpPerfIterations="), Iterations);
+		return FMath::Max(Iterations, 1);
+	}
+
+	// Creating and deleting objects is much more expensive than a call, so those benchmarks use fewer.
+	int32 GetObjectCount()
+	{
+		return FMath::Max(GetIterations() / 10, 1);
+	}
+
+	const FString& GetReportPath()
+	{
+		static const FString ReportPath = []
+		{
+			FString Path;
+			if (!FParse::Value(FCommandLine::Get(), TEXT("UnrealSharpPerfReport="), Path))
+			{
+				Path = FPaths::ProfilingDir() / FString::Printf(TEXT("UnrealSharpPerf-%s.json"), *FDateTime::Now().ToString());
+			}
+			return Path;
+		}();
+
+		return ReportPath;
+	}
+
+	// Rewritten after every benchmark, so a partial run still leaves a report behind.
+	bool WriteReport()
+	{
+		TSharedRef<FJsonObject> ResultsObject = MakeShared<FJsonObject>();
+		for (const TPair<FString, double>& Result : Results)
+		{
+			ResultsObject->SetNumberField(Result.Key, Result.Value);
+		}
+
+		TSharedRef<FJsonObject> Report = MakeShared<FJsonObject>();
+		Report->SetStringField(TEXT("Engine"), FEngineVersion::Current().ToString());
+		Report->SetStringField(TEXT("Platform"), FPlatformProperties::IniPlatformName());
+		Report->SetNumberField(TEXT("Iterations"), GetIterations());
+		Report->SetNumberField(TEXT("ObjectCount"), GetObjectCount());
+		Report->SetObjectField(TEXT("NanosecondsPerOp"), ResultsObject);
+
+		FString Json;
+		const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Json);
+
+		if (!FJsonSerializer::Serialize(Report, Writer) || !FFileHelper::SaveStringToFile(Json, *GetReportPath()))
+		{
+			UE_LOG(LogUnrealSharp, Warning, TEXT("Couldn't write the UnrealSharp performance report to '%s'"), *GetReportPath());
+			return false;
+		}
+
+		return true;
+	}
+
+	double ToNanosecondsPerOp(uint64 Cycles, int32 Count)
+	{
+		return FPlatformTime::ToSeconds64(Cycles) * 1e9 / Count;
+	}
+}
+
+IMPLEMENT_COMPLEX_AUTOMATION_TEST(FCSPerfTest, "UnrealSharp.Perf", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+void FCSPerfTest::GetTests(TArray<FString>& OutBeautifiedNames, TArray<FString>& OutTestCommands) const
+{
+	for (const TCHAR* Benchmark : ManagedBenchmarks)
+	{
+		OutBeautifiedNames.Add(Benchmark);
+		OutTestCommands.Add(Benchmark);
+	}
+
+	for (const TCHAR* Benchmark : NativeBenchmarks)
+	{
+		OutBeautifiedNames.Add(Benchmark);
+		OutTestCommands.Add(Benchmark);
+	}
+}
+
+bool FCSPerfTest::RunTest(const FString& Parameters)
+{
+	FCSManager& Manager = FCSManager::Get();
+	const FString AssemblyName = FCSProcHelper::GetUserManagedProjectName();
+
+	if (!Manager.LoadedPlugins.Contains(*AssemblyName))
+	{
+		AddError(FString::Printf(TEXT("The managed assembly %s isn't loaded, there's nothing to benchmark against."), *AssemblyName));
+		return false;
+	}
+
+	// The benchmarks live in the UnrealSharp assembly, which type lookups fall back to.
+	uint8* TypeHandle = Manager.GetTypeHandle(AssemblyName, TEXT("UnrealSharp.Benchmarks"), TEXT("InteropBenchmarks"));
+	void* RunBenchmark = FCSManagedCallbacks::ManagedCallbacks.LookupManagedMethod(TypeHandle, TEXT("RunBenchmark"));
+	void* Noop = FCSManagedCallbacks::ManagedCallbacks.LookupManagedMethod(TypeHandle, TEXT("Noop"));
+	void* CreateDelegate = FCSManagedCallbacks::ManagedCallbacks.LookupManagedMethod(TypeHandle, TEXT("CreateDelegate"));
+	void* AddDelegateHandler = FCSManagedCallbacks::ManagedCallbacks.LookupManagedMethod(TypeHandle, TEXT("AddDelegateHandler"));
+	void* ClearDelegateHandlers = FCSManagedCallbacks::ManagedCallbacks.LookupManagedMethod(TypeHandle, TEXT("ClearDelegateHandlers"));
+
+	if (!RunBenchmark || !Noop || !CreateDelegate || !AddDelegateHandler || !ClearDelegateHandlers)
+	{
+		AddError(TEXT("Couldn't find the managed benchmarks."));
+		return false;
+	}
+
+	// Managed methods are called on an object, the transient package is one that always exists.
+	UObject* Target = GetTransientPackage();
+	const GCHandleIntPtr TargetHandle = Manager.FindManagedObject(Target).GetHandle();
+
+	const int32 Iterations = GetIterations();
+	const int32 ObjectCount = GetObjectCount();
+	FString ExceptionMessage;
+
+	FCSBenchmarkRequest Request;
+	Request.Name = *Parameters;
+	Request.Iterations = Iterations;
+	Request.Object = Target;
+
+	TArray<int32> Array;
+	TMap<FName, int32> Map;
+
+	for (int32 i = 0; i < ContainerSize; ++i)
+	{
+		Array.Add(i);
+		Map.Add(FName(TEXT("Key"), i), i);
+	}
+
+	Request.ArrayProperty = FindFProperty<FArrayProperty>(ACSTestActor::StaticClass(), GET_MEMBER_NAME_CHECKED(ACSTestActor, MyTestArray));
+	Request.ArrayAddress = &Array;
+	Request.MapProperty = FindFProperty<FMapProperty>(ACSTestActor::StaticClass(), GET_MEMBER_NAME_CHECKED(ACSTestActor, MyTestMap));
+	Request.MapAddress = &Map;
+
+	double NanosecondsPerOp;
+
+	if (Parameters == TEXT("InvokeManagedMethod"))
+	{
+		const uint64 StartCycles = FPlatformTime::Cycles64();
+
+		for (int32 i = 0; i < Iterations; ++i)
+		{
+			FCSManagedCallbacks::ManagedCallbacks.InvokeManagedMethod(TargetHandle, Noop, &Request, nullptr, &ExceptionMessage);
+		}
+
+		NanosecondsPerOp = ToNanosecondsPerOp(FPlatformTime::Cycles64() - StartCycles, Iterations);
+	}
+	else if (Parameters == TEXT("Delegate.Invoke"))
+	{
+		if (FCSManagedCallbacks::ManagedCallbacks.InvokeManagedMethod(TargetHandle, CreateDelegate, &Request, nullptr, &ExceptionMessage) != 0)
+		{
+			AddError(ExceptionMessage);
+			return false;
+		}
+
+		const FScopedGCHandle DelegateHandle(Request.DelegateHandle);
+		const uint64 StartCycles = FPlatformTime::Cycles64();
+
+		for (int32 i = 0; i < Iterations; ++i)
+		{
+			FCSManagedCallbacks::ManagedCallbacks.InvokeDelegate(DelegateHandle.Handle.GetHandle());
+		}
+
+		NanosecondsPerOp = ToNanosecondsPerOp(FPlatformTime::Cycles64() - StartCycles, Iterations);
+	}
+	else if (Parameters == TEXT("Delegate.Broadcast"))
+	{
+		// A dynamic multicast delegate with a managed handler bound the way C# code binds one, through a UCSManagedDelegateTarget.
+		ACSTestActor* Actor = NewObject<ACSTestActor>(Target);
+		Request.DelegateProperty = FindFProperty<FMulticastDelegateProperty>(ACSTestActor::StaticClass(), GET_MEMBER_NAME_CHECKED(ACSTestActor, MyTestDelegate));
+		Request.DelegateAddress = &Actor->MyTestDelegate;
+
+		if (FCSManagedCallbacks::ManagedCallbacks.InvokeManagedMethod(TargetHandle, AddDelegateHandler, &Request, nullptr, &ExceptionMessage) != 0)
+		{
+			AddError(ExceptionMessage);
+			return false;
+		}
+
+		const FString MyString = TEXT("UnrealSharpPerf");
+		const uint64 StartCycles = FPlatformTime::Cycles64();
+
+		for (int32 i = 0; i < Iterations; ++i)
+		{
+			Actor->MyTestDelegate.Broadcast(i, MyString);
+		}
+
+		NanosecondsPerOp = ToNanosecondsPerOp(FPlatformTime::Cycles64() - StartCycles, Iterations);
+
+		FCSManagedCallbacks::ManagedCallbacks.InvokeManagedMethod(TargetHandle, ClearDelegateHandlers, &Request, nullptr, &ExceptionMessage);
+		Actor->MarkAsGarbage();
+	}
+	else if (Parameters == TEXT("Wrapper.Create") || Parameters == TEXT("GC.Delete"))
+	{
+		TArray<UObject*> Objects;
+		Objects.Reserve(ObjectCount);
+
+		for (int32 i = 0; i < ObjectCount; ++i)
+		{
+			Objects.Add(NewObject<UObject>(Target));
+		}
+
+		const uint64 WrapperStartCycles = FPlatformTime::Cycles64();
+
+		for (UObject* Object : Objects)
+		{
+			Manager.FindManagedObject(Object);
+		}
+
+		const uint64 WrapperCycles = FPlatformTime::Cycles64() - WrapperStartCycles;
+
+		for (UObject* Object : Objects)
+		{
+			Object->MarkAsGarbage();
+		}
+
+		// Deleting the objects also releases their wrappers, which is part of what's measured.
+		const uint64 DeleteStartCycles = FPlatformTime::Cycles64();
+		CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS, true);
+		const uint64 DeleteCycles = FPlatformTime::Cycles64() - DeleteStartCycles;
+
+		NanosecondsPerOp = ToNanosecondsPerOp(Parameters == TEXT("GC.Delete") ? DeleteCycles : WrapperCycles, ObjectCount);
+	}
+	else
+	{
+		if (FCSManagedCallbacks::ManagedCallbacks.InvokeManagedMethod(TargetHandle, RunBenchmark, &Request, nullptr, &ExceptionMessage) != 0)
+		{
+			AddError(ExceptionMessage);
+			return false;
+		}
+
+		NanosecondsPerOp = Request.NanosecondsPerOp;
+	}
+
+	Results.Add(Parameters, NanosecondsPerOp);
+	AddInfo(FString::Printf(TEXT("%s: %.1f ns"), *Parameters, NanosecondsPerOp));
+
+	if (WriteReport())
+	{
+		AddInfo(FString::Printf(TEXT("Report written to '%s'"), *GetReportPath()));
+	}
+
+	return true;
+}
+
+#endif
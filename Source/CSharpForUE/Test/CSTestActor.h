@@ -6,6 +6,8 @@
 #include "GameFramework/Actor.h"
 #include "CSTestActor.generated.h"
 
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FCSTestDelegate, int32, MyInteger, const FString&, MyString);
+
 UCLASS(Blueprintable, BlueprintType)
 class ACSTestActor : public AActor
 {
@@ -45,5 +47,9 @@ public:
 	// MyReadOnlyTestArray is a read-only test array
 	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category= "Test C#")
 	TArray<int> MyReadOnlyTestArray;
+
+	// MyTestDelegate is a test delegate with parameters
+	UPROPERTY(BlueprintAssignable, Category = "Test C#")
+	FCSTestDelegate MyTestDelegate;
 	
 };
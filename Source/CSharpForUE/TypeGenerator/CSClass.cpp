@@ -2,6 +2,8 @@
 #include "CSFunction.h"
 #include "CSharpForUE/CSDeveloperSettings.h"
 #include "CSharpForUE/CSManager.h"
+#include "CSharpForUE/CSInteropStats.h"
+#include "CSharpForUE/CSManagedStats.h"
 #include "Factories/CSPropertyFactory.h"
 
 #if ENGINE_MINOR_VERSION >= 4
@@ -104,6 +106,18 @@ bool UCSClass::InvokeManagedEvent(UObject* ObjectToInvokeOn, FFrame& Stack, cons
 		++Stack.Code;
 	}
 	
+#if WITH_CSHARP_INTEROP_STATS
+	TOptional<FCSScopedInteropCall> InteropCall;
+	if (FCSInteropStats::IsEnabled())
+	{
+		InteropCall.Emplace(FCSInteropStats::FindOrAdd(Function));
+	}
+#endif
+	
+#if WITH_CSHARP_MANAGED_STATS
+	FCSScopedManagedTime ManagedTime;
+#endif
+	
 	const FGCHandle ManagedObjectHandle = FCSManager::Get().FindManagedObject(ObjectToInvokeOn);
 	FString ExceptionMessage;
 	
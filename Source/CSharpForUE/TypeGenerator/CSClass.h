@@ -9,6 +9,21 @@ class FCSGeneratedClassBuilder;
 class UCSFunction;
 struct FCSharpClassInfo;
 
+// A default component of a managed actor class, resolved when the class is built so construction doesn't look anything up.
+struct FCSDefaultComponent
+{
+	FObjectProperty* Property = nullptr;
+
+	// Index of the default component to attach to, if it's one of ours and created before this one is attached.
+	int32 ParentIndex = INDEX_NONE;
+
+	// Otherwise the property holding the component to attach to, like a component created by a native parent class.
+	FObjectProperty* ParentProperty = nullptr;
+	
+	FName AttachmentSocket;
+	bool bIsRootComponent = false;
+};
+
 UCLASS()
 class CSHARPFORUE_API UCSClass : public UBlueprintGeneratedClass
 {
@@ -28,5 +43,11 @@ public:
 private:
 
 	TSharedPtr<FCSharpClassInfo> ClassMetaData;
+
+	// Default components of this class and its managed parents, parents first.
+	TArray<FCSDefaultComponent> DefaultComponents;
+
+	// The native class whose constructor runs before ours, resolved when the class is built.
+	UClass* FirstNativeClass = nullptr;
 	
 };
\ No newline at end of file
@@ -10,8 +10,10 @@ UCSFunction* FCSFunctionFactory::CreateFunction(UClass* Outer, const FName& Name
 	NewFunction->FunctionFlags = FunctionMetaData.FunctionFlags | FunctionFlags;
 	NewFunction->SetSuperStruct(ParentFunction);
 	NewFunction->SetManagedMethod(FCSGeneratedClassBuilder::TryGetManagedFunction(Outer, Name));
-	
+
+#if WITH_EDITOR
 	FCSMetaDataUtils::ApplyMetaData(FunctionMetaData.MetaData, NewFunction);
+#endif
 	FinalizeFunctionSetup(Outer, NewFunction);
 	return NewFunction;
 }
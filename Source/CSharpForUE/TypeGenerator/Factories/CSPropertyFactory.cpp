@@ -288,8 +288,10 @@ FProperty* FCSPropertyFactory::CreateProperty(UField* Outer, const FCSPropertyMe
 		{
 			NewProperty->SetPropertyFlags(NewProperty->PropertyFlags | CPF_ReferenceParm | CPF_OutParm);
 		}
-		
+
+#if WITH_EDITOR
 		FCSMetaDataUtils::ApplyMetaData(PropertyMetaData.MetaData, NewProperty);
+#endif
 		
 		return NewProperty;
 	}
@@ -6,9 +6,79 @@
 #include "UObject/UnrealType.h"
 #include "Engine/Blueprint.h"
 #include "CSharpForUE/TypeGenerator/CSClass.h"
+#include "CSharpForUE/TypeGenerator/CSFunction.h"
 #include "CSharpForUE/TypeGenerator/Factories/CSFunctionFactory.h"
 #include "CSharpForUE/TypeGenerator/Factories/CSPropertyFactory.h"
 #include "MetaData/CSDefaultComponentMetaData.h"
+#include "Misc/ScopeRWLock.h"
+
+namespace
+{
+	struct FClassAncestry
+	{
+		UCSClass* FirstManagedClass = nullptr;
+		UClass* FirstNativeClass = nullptr;
+		TSharedPtr<FCSharpClassInfo> ManagedClassInfo;
+	};
+
+	// Ancestry of classes that aren't UCSClasses. Objects can be constructed off the game thread while loading.
+	TMap<const UClass*, FClassAncestry> ClassAncestryCache;
+	FRWLock ClassAncestryLock;
+
+	void ClearClassAncestryCache()
+	{
+		FWriteScopeLock WriteLock(ClassAncestryLock);
+		ClassAncestryCache.Empty();
+	}
+
+	UCSClass* FindFirstManagedClass(UClass* Class)
+	{
+		while (Class && !FCSGeneratedClassBuilder::IsManagedType(Class))
+		{
+			Class = Class->GetSuperClass();
+		}
+		return static_cast<UCSClass*>(Class);
+	}
+
+	UClass* FindFirstNativeClass(UClass* Class)
+	{
+		while (!Class->HasAnyClassFlags(CLASS_Native) || FCSGeneratedClassBuilder::IsManagedType(Class))
+		{
+			Class = Class->GetSuperClass();
+		}
+		return Class;
+	}
+
+	FClassAncestry GetClassAncestry(UClass* Class)
+	{
+		{
+			FReadScopeLock ReadLock(ClassAncestryLock);
+			if (const FClassAncestry* FoundAncestry = ClassAncestryCache.Find(Class))
+			{
+				return *FoundAncestry;
+			}
+		}
+
+		// Classes can be destroyed by GC or reparented by a reload.
+		[[maybe_unused]] static const bool bRegisteredCacheInvalidation = []
+		{
+			FCoreUObjectDelegates::GetPostGarbageCollect().AddStatic(&ClearClassAncestryCache);
+			FCoreUObjectDelegates::ReloadCompleteDelegate.AddLambda([](EReloadCompleteReason)
+			{
+				ClearClassAncestryCache();
+			});
+			return true;
+		}();
+
+		FClassAncestry Ancestry;
+		Ancestry.FirstManagedClass = FindFirstManagedClass(Class);
+		Ancestry.FirstNativeClass = Ancestry.FirstManagedClass ? Ancestry.FirstManagedClass->FirstNativeClass : FindFirstNativeClass(Class);
+		
+		FWriteScopeLock WriteLock(ClassAncestryLock);
+		ClassAncestryCache.Add(Class, Ancestry);
+		return Ancestry;
+	}
+}
 
 void FCSGeneratedClassBuilder::StartBuildingType()
 {
@@ -35,6 +105,7 @@ void FCSGeneratedClassBuilder::StartBuildingType()
 	Field->ClassFlags = TypeMetaData->ClassFlags | SuperClass->ClassFlags & CLASS_ScriptInherit;
 
 	Field->SetSuperStruct(SuperClass);
+	Field->FirstNativeClass = FindFirstNativeClass(SuperClass);
 	Field->PropertyLink = SuperClass->PropertyLink;
 	Field->ClassWithin = SuperClass->ClassWithin;
 	Field->ClassCastFlags = SuperClass->ClassCastFlags;
@@ -81,6 +152,12 @@ void FCSGeneratedClassBuilder::StartBuildingType()
 	Field->StaticLink(true);
 	Field->AssembleReferenceTokenStream();
 
+	// Needs the linked properties, and has to be done before the default object is constructed with it.
+	if (Field->IsChildOf<AActor>())
+	{
+		BuildDefaultComponents(Field, TypeMetaData->Properties);
+	}
+
 	//Create the default object for this class
 	Field->GetDefaultObject();
 	
@@ -109,6 +186,20 @@ void FCSGeneratedClassBuilder::NewField(UCSClass* OldField, UCSClass* NewField)
 	FCSTypeRegistry::Get().GetOnNewClassEvent().Broadcast(OldField, NewField);
 }
 
+void FCSGeneratedClassBuilder::RebindExistingType()
+{
+	// The class keeps its layout, only point it at the types and methods of the newly loaded assembly.
+	Field->ClassMetaData = FCSTypeRegistry::GetClassInfoFromName(TypeMetaData->Name);
+	
+	for (TFieldIterator<UCSFunction> FunctionIt(Field, EFieldIteratorFlags::ExcludeSuper); FunctionIt; ++FunctionIt)
+	{
+		UCSFunction* Function = *FunctionIt;
+		Function->SetManagedMethod(TryGetManagedFunction(Field, Function->GetFName()));
+	}
+
+	FCSManager::Get().RecreateManagedObjects(Field);
+}
+
 void FCSGeneratedClassBuilder::ObjectConstructor(const FObjectInitializer& ObjectInitializer)
 {
 	TSharedPtr<FCSharpClassInfo> ClassInfo;
@@ -143,7 +234,7 @@ void FCSGeneratedClassBuilder::ActorConstructor(const FObjectInitializer& Object
 	Actor->PrimaryActorTick.bCanEverTick = ManagedClass->bCanTick;
 	Actor->PrimaryActorTick.bStartWithTickEnabled = ManagedClass->bCanTick;
 	
-	SetupDefaultSubobjects(ObjectInitializer, Actor, ObjectInitializer.GetClass(), ManagedClass, ClassInfo);
+	SetupDefaultSubobjects(ObjectInitializer, Actor, ManagedClass);
 	
 	// Make the actual object in C#
 	FCSManager::Get().CreateNewManagedObject(ObjectInitializer.GetObj(), ClassInfo->TypeHandle);
@@ -155,74 +246,118 @@ void FCSGeneratedClassBuilder::InitialSetup(const FObjectInitializer& ObjectInit
 	ClassInfo = ManagedClass->GetClassInfo().ToSharedPtr();
 	
 	//Execute the native class' constructor first.
-	UClass* NativeClass = GetFirstNativeClass(ObjectInitializer.GetClass());
-	NativeClass->ClassConstructor(ObjectInitializer);
+	ManagedClass->FirstNativeClass->ClassConstructor(ObjectInitializer);
 }
 
-void FCSGeneratedClassBuilder::SetupDefaultSubobjects(const FObjectInitializer& ObjectInitializer,
-                                                      AActor* Actor,
-                                                      UClass* ActorClass,
-                                                      UCSClass* FirstManagedClass,
-                                                      const TSharedPtr<FCSharpClassInfo>& ClassInfo)
+void FCSGeneratedClassBuilder::SetupDefaultSubobjects(const FObjectInitializer& ObjectInitializer, AActor* Actor, const UCSClass* ManagedClass)
 {
-	if (UCSClass* ManagedClass = Cast<UCSClass>(FirstManagedClass->GetSuperClass()))
+	const TArray<FCSDefaultComponent>& DefaultComponents = ManagedClass->DefaultComponents;
+	
+	if (DefaultComponents.IsEmpty())
 	{
-		SetupDefaultSubobjects(ObjectInitializer, Actor, ActorClass, ManagedClass, ManagedClass->GetClassInfo());
+		return;
 	}
+
+	TArray<UObject*, TInlineAllocator<16>> Components;
+	Components.Reserve(DefaultComponents.Num());
 	
-	TMap<FObjectProperty*, TSharedPtr<FCSDefaultComponentMetaData>> DefaultComponents;
-	TArray<FCSPropertyMetaData>& Properties = ClassInfo->TypeMetaData->Properties;
-	
-	for (const FCSPropertyMetaData& PropertyMetaData : Properties)
+	for (const FCSDefaultComponent& DefaultComponent : DefaultComponents)
 	{
-		if (PropertyMetaData.Type->PropertyType != ECSPropertyType::DefaultComponent)
-		{
-			continue;
-		}
-
-		TSharedPtr<FCSDefaultComponentMetaData> DefaultComponent = StaticCastSharedPtr<FCSDefaultComponentMetaData>(PropertyMetaData.Type);
-		FObjectProperty* ObjectProperty = CastField<FObjectProperty>(ActorClass->FindPropertyByName(PropertyMetaData.Name));
-		
+		FObjectProperty* ObjectProperty = DefaultComponent.Property;
 		UObject* NewSubObject = ObjectInitializer.CreateDefaultSubobject(Actor, ObjectProperty->GetFName(), ObjectProperty->PropertyClass, ObjectProperty->PropertyClass, true, false);
 		ObjectProperty->SetObjectPropertyValue_InContainer(Actor, NewSubObject);
-		DefaultComponents.Add(ObjectProperty, DefaultComponent);
+		Components.Add(NewSubObject);
 	}
 
-	for (const TTuple<FObjectProperty*, TSharedPtr<FCSDefaultComponentMetaData>> DefaultComponent : DefaultComponents)
+	for (int32 Index = 0; Index < DefaultComponents.Num(); ++Index)
 	{
-		FObjectProperty* Property = DefaultComponent.Key;
-		TSharedPtr<FCSDefaultComponentMetaData> DefaultComponentMetaData = DefaultComponent.Value;
-		
-		USceneComponent* SceneComponent = Cast<USceneComponent>(Property->GetObjectPropertyValue_InContainer(Actor));
+		const FCSDefaultComponent& DefaultComponent = DefaultComponents[Index];
+		USceneComponent* SceneComponent = Cast<USceneComponent>(Components[Index]);
 		
 		if (!SceneComponent)
 		{
 			continue;
 		}
 
-		if (!Actor->GetRootComponent() && DefaultComponentMetaData->IsRootComponent)
+		if (!Actor->GetRootComponent() && DefaultComponent.bIsRootComponent)
 		{
 			Actor->SetRootComponent(SceneComponent);
 			continue;
 		}
 
-		FName AttachmentComponentName = DefaultComponentMetaData->AttachmentComponent;
-		FName AttachmentSocketName = DefaultComponentMetaData->AttachmentSocket;
-
-		if (FObjectProperty* ObjectProperty = FindFProperty<FObjectProperty>(Actor->GetClass(), *AttachmentComponentName.ToString(), EFieldIterationFlags::IncludeSuper))
+		USceneComponent* AttachmentComponent = nullptr;
+		if (DefaultComponent.ParentIndex != INDEX_NONE)
 		{
-			USceneComponent* AttachmentComponent = Cast<USceneComponent>(ObjectProperty->GetObjectPropertyValue_InContainer(Actor));
-			if (IsValid(AttachmentComponent))
-			{
-				SceneComponent->SetupAttachment(AttachmentComponent, AttachmentSocketName.IsNone() ? NAME_None : AttachmentSocketName);
-				continue;
-			}
+			AttachmentComponent = Cast<USceneComponent>(Components[DefaultComponent.ParentIndex]);
+		}
+		else if (DefaultComponent.ParentProperty)
+		{
+			AttachmentComponent = Cast<USceneComponent>(DefaultComponent.ParentProperty->GetObjectPropertyValue_InContainer(Actor));
+		}
+		
+		if (IsValid(AttachmentComponent))
+		{
+			SceneComponent->SetupAttachment(AttachmentComponent, DefaultComponent.AttachmentSocket);
+			continue;
 		}
 		
 		SceneComponent->SetupAttachment(Actor->GetRootComponent());
 	}
 }
 
+void FCSGeneratedClassBuilder::BuildDefaultComponents(UCSClass* ManagedClass, const TArray<FCSPropertyMetaData>& Properties)
+{
+	ManagedClass->DefaultComponents.Reset();
+
+	// Managed parents are always built first, their components are created before ours.
+	if (const UCSClass* ManagedSuperClass = Cast<UCSClass>(ManagedClass->GetSuperClass()))
+	{
+		ManagedClass->DefaultComponents = ManagedSuperClass->DefaultComponents;
+	}
+
+	const int32 FirstComponentIndex = ManagedClass->DefaultComponents.Num();
+	TArray<TSharedPtr<FCSDefaultComponentMetaData>, TInlineAllocator<16>> ComponentsMetaData;
+	
+	for (const FCSPropertyMetaData& PropertyMetaData : Properties)
+	{
+		if (PropertyMetaData.Type->PropertyType != ECSPropertyType::DefaultComponent)
+		{
+			continue;
+		}
+
+		FCSDefaultComponent& DefaultComponent = ManagedClass->DefaultComponents.AddDefaulted_GetRef();
+		DefaultComponent.Property = CastFieldChecked<FObjectProperty>(ManagedClass->FindPropertyByName(PropertyMetaData.Name));
+		ComponentsMetaData.Add(StaticCastSharedPtr<FCSDefaultComponentMetaData>(PropertyMetaData.Type));
+	}
+
+	// All of this class' components exist by the time any of them is attached, so they can attach to each other in any order.
+	for (int32 Index = 0; Index < ComponentsMetaData.Num(); ++Index)
+	{
+		const TSharedPtr<FCSDefaultComponentMetaData>& ComponentMetaData = ComponentsMetaData[Index];
+		FCSDefaultComponent& DefaultComponent = ManagedClass->DefaultComponents[FirstComponentIndex + Index];
+		
+		DefaultComponent.bIsRootComponent = ComponentMetaData->IsRootComponent;
+		DefaultComponent.AttachmentSocket = ComponentMetaData->AttachmentSocket;
+
+		FObjectProperty* AttachmentProperty = FindFProperty<FObjectProperty>(ManagedClass, ComponentMetaData->AttachmentComponent, EFieldIterationFlags::IncludeSuper);
+		
+		if (!AttachmentProperty)
+		{
+			continue;
+		}
+
+		DefaultComponent.ParentIndex = ManagedClass->DefaultComponents.IndexOfByPredicate([AttachmentProperty](const FCSDefaultComponent& Component)
+		{
+			return Component.Property == AttachmentProperty;
+		});
+
+		if (DefaultComponent.ParentIndex == INDEX_NONE)
+		{
+			DefaultComponent.ParentProperty = AttachmentProperty;
+		}
+	}
+}
+
 void FCSGeneratedClassBuilder::ImplementInterfaces(UClass* ManagedClass, const TArray<FName>& Interfaces)
 {
 	for (const FName& InterfaceName : Interfaces)
@@ -256,20 +391,55 @@ void* FCSGeneratedClassBuilder::TryGetManagedFunction(UClass* Outer, const FName
 
 UCSClass* FCSGeneratedClassBuilder::GetFirstManagedClass(UClass* Class)
 {
-	while (Class && !IsManagedType(Class))
+	if (!Class || IsManagedType(Class))
 	{
-		Class = Class->GetSuperClass();
+		return static_cast<UCSClass*>(Class);
 	}
-	return Cast<UCSClass>(Class);
+	
+	return GetClassAncestry(Class).FirstManagedClass;
 }
 
 UClass* FCSGeneratedClassBuilder::GetFirstNativeClass(UClass* Class)
 {
-	while (!Class->HasAnyClassFlags(CLASS_Native) || IsManagedType(Class))
+	if (IsManagedType(Class))
 	{
-		Class = Class->GetSuperClass();
+		return static_cast<UCSClass*>(Class)->FirstNativeClass;
 	}
-	return Class;
+
+	if (Class->HasAnyClassFlags(CLASS_Native))
+	{
+		return Class;
+	}
+	
+	return GetClassAncestry(Class).FirstNativeClass;
+}
+
+TSharedRef<FCSharpClassInfo> FCSGeneratedClassBuilder::GetManagedClassInfo(UClass* Class)
+{
+	if (UCSClass* ManagedClass = GetFirstManagedClass(Class))
+	{
+		return ManagedClass->GetClassInfo();
+	}
+
+	UClass* NativeClass = GetFirstNativeClass(Class);
+	{
+		FReadScopeLock ReadLock(ClassAncestryLock);
+		const FClassAncestry* FoundAncestry = ClassAncestryCache.Find(NativeClass);
+		
+		if (FoundAncestry && FoundAncestry->ManagedClassInfo.IsValid())
+		{
+			return FoundAncestry->ManagedClassInfo.ToSharedRef();
+		}
+	}
+
+	// Native classes get their type info on first use, from the game thread.
+	TSharedRef<FCSharpClassInfo> ClassInfo = FCSTypeRegistry::Get().FindManagedType(NativeClass);
+	
+	FWriteScopeLock WriteLock(ClassAncestryLock);
+	FClassAncestry& Ancestry = ClassAncestryCache.FindOrAdd(NativeClass);
+	Ancestry.FirstNativeClass = NativeClass;
+	Ancestry.ManagedClassInfo = ClassInfo;
+	return ClassInfo;
 }
 
 UClass* FCSGeneratedClassBuilder::GetFirstNonBlueprintClass(UClass* Class)
@@ -14,12 +14,19 @@ public:
 	// TCSGeneratedTypeBuilder interface implementation
 	virtual void StartBuildingType() override;
 	virtual void NewField(UCSClass* OldField, UCSClass* NewField) override;
+	virtual void RebindExistingType() override;
 	// End of implementation
 	
 	static void* TryGetManagedFunction(UClass* Outer, const FName& MethodName);
 
+	// Managed classes answer these from what was resolved when they were built.
+	// Other classes, like Blueprints deriving from managed classes, are cached until the next GC or reload.
 	static UCSClass* GetFirstManagedClass(UClass* Class);
 	static UClass* GetFirstNativeClass(UClass* Class);
+
+	// The type info managed objects for instances of this class are created from.
+	static TSharedRef<FCSharpClassInfo> GetManagedClassInfo(UClass* Class);
+	
 	static UClass* GetFirstNonBlueprintClass(UClass* Class);
 
 	static bool IsManagedType(const UClass* Class);
@@ -32,11 +39,8 @@ private:
 
 	static void InitialSetup(const FObjectInitializer& ObjectInitializer, TSharedPtr<FCSharpClassInfo>& ClassInfo, UCSClass*& ManagedClass);
 	
-	static void SetupDefaultSubobjects(const FObjectInitializer& ObjectInitializer,
-		AActor* Actor,
-		UClass* ActorClass,
-		UCSClass* FirstManagedClass,
-		const TSharedPtr<FCSharpClassInfo>& ClassInfo);
+	static void SetupDefaultSubobjects(const FObjectInitializer& ObjectInitializer, AActor* Actor, const UCSClass* ManagedClass);
+	static void BuildDefaultComponents(UCSClass* ManagedClass, const TArray<FCSPropertyMetaData>& Properties);
 	
 	static void ImplementInterfaces(UClass* ManagedClass, const TArray<FName>& Interfaces);
 };
@@ -21,7 +21,7 @@ public:
 	TField* CreateType()
 	{
 		UPackage* Package = FCSManager::GetUnrealSharpPackage();
-		FString FieldName = FString::Printf(TEXT("%s_C"), *TypeMetaData->Name.ToString());
+		FString FieldName = GetFieldName();
 		TField* ExistingField = FindObject<TField>(Package, *FieldName);
 		
 		if (ExistingField)
@@ -43,9 +43,9 @@ public:
 		Field = NewObject<TField>(Package, TField::StaticClass(), *FieldName, RF_Public | RF_MarkAsRootSet | RF_Transactional);
 		
 		ApplyBlueprintAccess(Field);
-		FCSMetaDataUtils::ApplyMetaData(TypeMetaData->MetaData, Field);
 
 #if WITH_EDITOR
+		FCSMetaDataUtils::ApplyMetaData(TypeMetaData->MetaData, Field);
 		Field->SetMetaData(TEXT("DisplayName"), *TypeMetaData->Name.ToString());
 #endif
 
@@ -57,10 +57,25 @@ public:
 		return Field;
 	}
 
+	// Picks up the field built by a previous load of the assembly, when the layout of the type didn't change since.
+	// Returns nullptr if there is no such field and the type has to be built from scratch.
+	TField* TryReuseExistingType()
+	{
+		Field = FindObject<TField>(FCSManager::GetUnrealSharpPackage(), *GetFieldName());
+
+		if (Field)
+		{
+			RebindExistingType();
+		}
+		
+		return Field;
+	}
+
 	// Start TCSGeneratedTypeBuilder interface
 	virtual void StartBuildingType() = 0;
 	virtual void NewField(TField* OldField, TField* NewField) {};
 	virtual bool ReplaceTypeOnReload() const { return true; }
+	virtual void RebindExistingType() {};
 	// End of interface
 
 	void RegisterFieldToLoader(ENotifyRegistrationType RegistrationType)
@@ -80,6 +95,11 @@ protected:
 	TField* Field;
 
 private:
+
+	FString GetFieldName() const
+	{
+		return FString::Printf(TEXT("%s_C"), *TypeMetaData->Name.ToString());
+	}
 	
 	static void ApplyBlueprintAccess(UField* Field)
 	{
@@ -35,6 +35,7 @@ void FCSMetaDataUtils::SerializeProperty(const TSharedPtr<FJsonObject>& Property
 	PropertiesMetaData.SerializeFromJson(PropertyMetaData);
 }
 
+#if WITH_EDITOR
 void FCSMetaDataUtils::SerializeFromJson(const TSharedPtr<FJsonObject>& JsonObject, TMap<FString, FString>& MetaDataMap)
 {
 	const TSharedPtr<FJsonObject>* MetaDataObjectPtr;
@@ -55,20 +56,29 @@ void FCSMetaDataUtils::SerializeFromJson(const TSharedPtr<FJsonObject>& JsonObje
 
 void FCSMetaDataUtils::ApplyMetaData(const TMap<FString, FString>& MetaDataMap, UField* Field)
 {
-#if WITH_EDITOR
 	for (const auto& MetaData : MetaDataMap)
 	{
 		Field->SetMetaData(*MetaData.Key, *MetaData.Value);
 	}
-#endif
 }
 
 void FCSMetaDataUtils::ApplyMetaData(const TMap<FString, FString>& MetaDataMap, FField* Field)
 {
-#if WITH_EDITOR
 	for (const auto& MetaData : MetaDataMap)
 	{
 		Field->SetMetaData(*MetaData.Key, *MetaData.Value);
 	}
-#endif
 }
+
+SIZE_T FCSMetaDataUtils::GetAllocatedSize(const TMap<FString, FString>& MetaDataMap)
+{
+	SIZE_T Size = MetaDataMap.GetAllocatedSize();
+	
+	for (const auto& MetaData : MetaDataMap)
+	{
+		Size += MetaData.Key.GetAllocatedSize() + MetaData.Value.GetAllocatedSize();
+	}
+	
+	return Size;
+}
+#endif
@@ -29,7 +29,23 @@ namespace FCSMetaDataUtils
 		return static_cast<FlagType>(FunctionFlagsInt);
 	};
 	
+	template<typename T>
+	SIZE_T GetAllocatedSize(const TArray<T>& MetaData)
+	{
+		SIZE_T Size = MetaData.GetAllocatedSize();
+		
+		for (const T& Element : MetaData)
+		{
+			Size += Element.GetAllocatedSize();
+		}
+		
+		return Size;
+	}
+
+#if WITH_EDITOR
 	void SerializeFromJson(const TSharedPtr<FJsonObject>& JsonObject, TMap<FString, FString>& MetaDataMap);
 	void ApplyMetaData(const TMap<FString, FString>& MetaDataMap, UField* Field);
 	void ApplyMetaData(const TMap<FString, FString>& MetaDataMap, FField* Field);
+	SIZE_T GetAllocatedSize(const TMap<FString, FString>& MetaDataMap);
+#endif
 }
\ No newline at end of file
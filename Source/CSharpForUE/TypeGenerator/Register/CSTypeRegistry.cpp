@@ -1,8 +1,12 @@
 #include "CSTypeRegistry.h"
 #include "CSharpForUE/CSharpForUE.h"
+#include "CSharpForUE/CSStartupTimings.h"
 #include "Misc/FileHelper.h"
 #include "Serialization/JsonSerializer.h"
 #include "Serialization/JsonReader.h"
+#include "Serialization/JsonWriter.h"
+#include "Hash/CityHash.h"
+#include "HAL/IConsoleManager.h"
 #include "TypeInfo/CSClassInfo.h"
 #include "UnrealSharpProcHelper/CSProcHelper.h"
 #include "UnrealSharpUtilities/UnrealSharpStatics.h"
@@ -16,8 +20,119 @@ void InitializeBuilders(TMap<FName, T>& Map)
 	}
 }
 
+namespace
+{
+	void GatherTypeReferences(const TSharedPtr<FJsonValue>& Value, TSet<FName>& OutReferences)
+	{
+		if (Value->Type == EJson::Array)
+		{
+			for (const TSharedPtr<FJsonValue>& Element : Value->AsArray())
+			{
+				GatherTypeReferences(Element, OutReferences);
+			}
+			return;
+		}
+
+		if (Value->Type != EJson::Object)
+		{
+			return;
+		}
+
+		const TSharedPtr<FJsonObject>& Object = Value->AsObject();
+
+		// Type references are the only objects that name the assembly they live in.
+		FString TypeName;
+		if (Object->HasField(TEXT("AssemblyName")) && Object->TryGetStringField(TEXT("Name"), TypeName))
+		{
+			OutReferences.Add(*TypeName);
+		}
+
+		for (const TPair<FString, TSharedPtr<FJsonValue>>& Field : Object->Values)
+		{
+			GatherTypeReferences(Field.Value, OutReferences);
+		}
+	}
+
+	void GatherTypeLayout(const TSharedPtr<FJsonValue>& MetaData, FName TypeName, TMap<FName, FCSTypeLayout>& OutLayouts)
+	{
+		FString JsonString;
+		TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&JsonString);
+		FJsonSerializer::Serialize(MetaData->AsObject().ToSharedRef(), Writer);
+
+		FCSTypeLayout& Layout = OutLayouts.Add(TypeName);
+		Layout.Hash = CityHash64(reinterpret_cast<const char*>(*JsonString), JsonString.Len() * sizeof(TCHAR));
+		
+		GatherTypeReferences(MetaData, Layout.References);
+		Layout.References.Remove(TypeName);
+	}
+
+	struct FCSAssemblyMetaDataMemory
+	{
+		int32 NumTypes = 0;
+		int32 NumTypesWithMetaData = 0;
+		SIZE_T MetaDataSize = 0;
+	};
+
+	template<typename T>
+	void GatherMetaDataMemory(const TMap<FName, T>& Map, TMap<FName, FCSAssemblyMetaDataMemory>& OutMemory)
+	{
+		for (const auto& Pair : Map)
+		{
+			// Native classes are added as managed code asks for them and have no metadata.
+			if (Pair.Value->AssemblyName.IsNone())
+			{
+				continue;
+			}
+			
+			FCSAssemblyMetaDataMemory& Memory = OutMemory.FindOrAdd(Pair.Value->AssemblyName);
+			const SIZE_T MetaDataSize = Pair.Value->GetMetaDataSize();
+			
+			++Memory.NumTypes;
+			Memory.NumTypesWithMetaData += MetaDataSize > 0 ? 1 : 0;
+			Memory.MetaDataSize += MetaDataSize;
+		}
+	}
+
+	FAutoConsoleCommandWithOutputDevice DumpMetaDataMemoryCommand(
+		TEXT("UnrealSharp.MetaDataMemory"),
+		TEXT("Prints how much memory the type metadata of each managed assembly still holds."),
+		FConsoleCommandWithOutputDeviceDelegate::CreateLambda([](FOutputDevice& Ar)
+		{
+			const FCSTypeRegistry& Registry = FCSTypeRegistry::Get();
+			
+			TMap<FName, FCSAssemblyMetaDataMemory> MemoryByAssembly;
+			GatherMetaDataMemory(Registry.ManagedClasses, MemoryByAssembly);
+			GatherMetaDataMemory(Registry.ManagedStructs, MemoryByAssembly);
+			GatherMetaDataMemory(Registry.ManagedEnums, MemoryByAssembly);
+			GatherMetaDataMemory(Registry.ManagedInterfaces, MemoryByAssembly);
+
+			SIZE_T TotalSize = 0;
+			for (const TPair<FName, FCSAssemblyMetaDataMemory>& Memory : MemoryByAssembly)
+			{
+				Ar.Logf(TEXT("%s: %d types, %d holding metadata, %llu bytes"), *Memory.Key.ToString(), Memory.Value.NumTypes, Memory.Value.NumTypesWithMetaData, static_cast<uint64>(Memory.Value.MetaDataSize));
+				TotalSize += Memory.Value.MetaDataSize;
+			}
+
+			Ar.Logf(TEXT("Total: %llu bytes"), static_cast<uint64>(TotalSize));
+		}));
+
+	template<typename T>
+	void MarkUnchangedTypes(TMap<FName, T>& Map, const TMap<FName, FCSTypeLayout>& Layouts, const TSet<FName>& ChangedTypes)
+	{
+		for (const TPair<FName, FCSTypeLayout>& Layout : Layouts)
+		{
+			if (const T* TypeInfo = Map.Find(Layout.Key))
+			{
+				(*TypeInfo)->bLayoutUnchanged = !ChangedTypes.Contains(Layout.Key);
+			}
+		}
+	}
+}
+
 bool FCSTypeRegistry::ProcessMetaData(const FString& FilePath)
 {
+	CS_STARTUP_PHASE(TEXT("ProcessMetaData"));
+	
 	if (!FPaths::FileExists(FilePath))
 	{
 		UE_LOG(LogUnrealSharp, Fatal, TEXT("Couldn't find metadata file at: %s"), *FilePath);
@@ -38,10 +153,13 @@ bool FCSTypeRegistry::ProcessMetaData(const FString& FilePath)
 		return false;
 	}
 	
+	TMap<FName, FCSTypeLayout> TypeLayouts;
+	
 	for (const auto& MetaData : JsonObject->GetArrayField(TEXT("ClassMetaData")))
 	{
 		TSharedPtr<FCSharpClassInfo> ClassInfo = MakeShared<FCSharpClassInfo>(MetaData);
 		ManagedClasses.Add(ClassInfo->TypeMetaData->Name, ClassInfo);
+		GatherTypeLayout(MetaData, ClassInfo->TypeMetaData->Name, TypeLayouts);
 	}
 
 	const TArray<TSharedPtr<FJsonValue>>& StructMetaData = JsonObject->GetArrayField(TEXT("StructMetaData"));
@@ -49,6 +167,7 @@ bool FCSTypeRegistry::ProcessMetaData(const FString& FilePath)
 	{
 		TSharedPtr<FCSharpStructInfo> StructInfo = MakeShared<FCSharpStructInfo>(MetaData);
 		ManagedStructs.Add(StructInfo->TypeMetaData->Name, StructInfo);
+		GatherTypeLayout(MetaData, StructInfo->TypeMetaData->Name, TypeLayouts);
 	}
 
 	const TArray<TSharedPtr<FJsonValue>>& EnumMetaData = JsonObject->GetArrayField(TEXT("EnumMetaData"));
@@ -56,6 +175,7 @@ bool FCSTypeRegistry::ProcessMetaData(const FString& FilePath)
 	{
 		TSharedPtr<FCSharpEnumInfo> EnumInfo = MakeShared<FCSharpEnumInfo>(MetaData);
 		ManagedEnums.Add(EnumInfo->TypeMetaData->Name, EnumInfo);
+		GatherTypeLayout(MetaData, EnumInfo->TypeMetaData->Name, TypeLayouts);
 	}
 
 	const TArray<TSharedPtr<FJsonValue>>& InterfacesMetaData = JsonObject->GetArrayField(TEXT("InterfacesMetaData"));
@@ -63,8 +183,17 @@ bool FCSTypeRegistry::ProcessMetaData(const FString& FilePath)
 	{
 		TSharedPtr<FCSharpInterfaceInfo> InterfaceInfo = MakeShared<FCSharpInterfaceInfo>(MetaData);
 		ManagedInterfaces.Add(InterfaceInfo->TypeMetaData->Name, InterfaceInfo);
+		GatherTypeLayout(MetaData, InterfaceInfo->TypeMetaData->Name, TypeLayouts);
 	}
 
+	// On hot reload, types that kept their layout reuse their existing field instead of being reinstanced.
+	const TSet<FName> ChangedTypes = UpdateTypeLayouts(TypeLayouts);
+	MarkUnchangedTypes(ManagedClasses, TypeLayouts, ChangedTypes);
+	MarkUnchangedTypes(ManagedStructs, TypeLayouts, ChangedTypes);
+	MarkUnchangedTypes(ManagedEnums, TypeLayouts, ChangedTypes);
+	MarkUnchangedTypes(ManagedInterfaces, TypeLayouts, ChangedTypes);
+
+	CS_STARTUP_PHASE(TEXT("BuildTypes"));
 	InitializeBuilders(ManagedClasses);
 	InitializeBuilders(ManagedStructs);
 	InitializeBuilders(ManagedEnums);
@@ -105,7 +234,7 @@ UClass* FCSTypeRegistry::GetClassFromName(FName Name)
 	}
 	else
 	{
-		FoundType = FindFirstObjectSafe<UClass>(*Name.ToString());
+		FoundType = FindNativeType(Get().NativeClasses, Name);
 	}
 	
 	return FoundType;
@@ -121,7 +250,7 @@ UScriptStruct* FCSTypeRegistry::GetStructFromName(FName Name)
 	}
 	else
 	{
-		FoundType = FindFirstObjectSafe<UScriptStruct>(*Name.ToString());
+		FoundType = FindNativeType(Get().NativeStructs, Name);
 	}
 	
 	return FoundType;
@@ -137,7 +266,7 @@ UEnum* FCSTypeRegistry::GetEnumFromName(FName Name)
 	}
 	else
 	{
-		FoundType = FindFirstObjectSafe<UEnum>(*Name.ToString());
+		FoundType = FindNativeType(Get().NativeEnums, Name);
 	}
 	
 	return FoundType;
@@ -153,18 +282,107 @@ UClass* FCSTypeRegistry::GetInterfaceFromName(FName Name)
 	}
 	else
 	{
-		FoundType = FindFirstObjectSafe<UClass>(*Name.ToString());
+		FoundType = FindNativeType(Get().NativeClasses, Name);
 	}
 	
 	return FoundType;
 }
 
+template<typename T>
+T* FCSTypeRegistry::FindNativeType(TMap<FName, TWeakObjectPtr<T>>& Cache, FName Name)
+{
+	FRWLock& Lock = Get().NativeTypesLock;
+	
+	{
+		FReadScopeLock ReadLock(Lock);
+		if (T* CachedType = Cache.FindRef(Name).Get())
+		{
+			return CachedType;
+		}
+	}
+
+	T* FoundType = FindFirstObjectSafe<T>(*Name.ToString());
+
+	// Misses aren't cached, the type may still come with a module that isn't loaded yet.
+	if (FoundType)
+	{
+		FWriteScopeLock WriteLock(Lock);
+		Cache.Add(Name, FoundType);
+	}
+	
+	return FoundType;
+}
+
+void FCSTypeRegistry::InvalidateTypeCache()
+{
+	FWriteScopeLock WriteLock(NativeTypesLock);
+	NativeClasses.Reset();
+	NativeStructs.Reset();
+	NativeEnums.Reset();
+	++TypeCacheGeneration;
+}
+
+TSet<FName> FCSTypeRegistry::UpdateTypeLayouts(const TMap<FName, FCSTypeLayout>& NewLayouts)
+{
+	TSet<FName> ChangedTypes;
+	
+	for (const TPair<FName, FCSTypeLayout>& Layout : NewLayouts)
+	{
+		const uint64* PreviousHash = TypeLayoutHashes.Find(Layout.Key);
+		
+		if (!PreviousHash || *PreviousHash != Layout.Value.Hash)
+		{
+			ChangedTypes.Add(Layout.Key);
+		}
+	}
+
+	// Anything that refers to a changed type is rebuilt as well, its properties and parameters have to point at the new type.
+	bool bFoundDependentType = true;
+	while (bFoundDependentType)
+	{
+		bFoundDependentType = false;
+		
+		for (const TPair<FName, FCSTypeLayout>& Layout : NewLayouts)
+		{
+			if (ChangedTypes.Contains(Layout.Key))
+			{
+				continue;
+			}
+
+			for (const FName& Reference : Layout.Value.References)
+			{
+				if (ChangedTypes.Contains(Reference))
+				{
+					ChangedTypes.Add(Layout.Key);
+					bFoundDependentType = true;
+					break;
+				}
+			}
+		}
+	}
+
+	if (!TypeLayoutHashes.IsEmpty())
+	{
+		UE_LOG(LogUnrealSharp, Display, TEXT("%d of %d managed types changed their layout and will be reinstanced."), ChangedTypes.Num(), NewLayouts.Num());
+	}
+
+	for (const TPair<FName, FCSTypeLayout>& Layout : NewLayouts)
+	{
+		TypeLayoutHashes.Add(Layout.Key, Layout.Value.Hash);
+	}
+
+	return ChangedTypes;
+}
+
 void FCSTypeRegistry::OnModulesChanged(FName InModuleName, EModuleChangeReason InModuleChangeReason)
 {
 	if (InModuleChangeReason != EModuleChangeReason::ModuleLoaded)
 	{
 		return;
 	}
+
+	// A reloaded module may replace the types that were found before.
+	InvalidateTypeCache();
 	
 	for (auto Itr = PendingClasses.CreateIterator(); Itr; ++Itr)
 	{
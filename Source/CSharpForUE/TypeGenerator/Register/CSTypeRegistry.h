@@ -15,6 +15,15 @@ struct FPendingClasses
 	TSet<FCSharpClassInfo*> Classes;
 };
 
+struct FCSTypeLayout
+{
+	// Hash of the metadata the type is built from.
+	uint64 Hash = 0;
+
+	// Other types named in the metadata: parent class, interfaces, property and parameter types.
+	TSet<FName> References;
+};
+
 class CSHARPFORUE_API FCSTypeRegistry
 {
 
@@ -23,6 +32,9 @@ public:
 	FCSTypeRegistry()
 	{
 		FModuleManager::Get().OnModulesChanged().AddRaw(this, &FCSTypeRegistry::OnModulesChanged);
+		OnNewClass.AddLambda([this](UClass*, UClass*) { InvalidateTypeCache(); });
+		OnNewStruct.AddLambda([this](UScriptStruct*, UScriptStruct*) { InvalidateTypeCache(); });
+		FCoreUObjectDelegates::ReloadCompleteDelegate.AddLambda([this](EReloadCompleteReason) { InvalidateTypeCache(); });
 	}
 	
 	static FCSTypeRegistry& Get()
@@ -64,6 +76,9 @@ public:
 		return Get().ManagedInterfaces.FindRef(Name);
 	};
 
+	// Changes whenever a type that was looked up by name may have been replaced, so caches of those lookups know to start over.
+	const int32* GetTypeCacheGeneration() const { return &TypeCacheGeneration; }
+
 	TMap<FName, TSharedPtr<FCSharpClassInfo>> ManagedClasses;
 	TMap<FName, TSharedPtr<FCSharpStructInfo>> ManagedStructs;
 	TMap<FName, TSharedPtr<FCSharpEnumInfo>> ManagedEnums;
@@ -72,8 +87,28 @@ public:
 private:
 	
 	void OnModulesChanged(FName InModuleName, EModuleChangeReason InModuleChangeReason);
+
+	// Finds the types that have to be rebuilt: their own metadata changed, or that of a type they depend on.
+	TSet<FName> UpdateTypeLayouts(const TMap<FName, FCSTypeLayout>& NewLayouts);
+
+	template<typename T>
+	static T* FindNativeType(TMap<FName, TWeakObjectPtr<T>>& Cache, FName Name);
+
+	void InvalidateTypeCache();
 	
 	TMap<FName, FPendingClasses> PendingClasses;
+
+	// Layout hash of every managed type, as it was last built.
+	TMap<FName, uint64> TypeLayoutHashes;
+
+	// Native types found by name, so each is only searched for once in the global object list.
+	// Types can be looked up off the game thread while loading, so the caches are behind a lock.
+	TMap<FName, TWeakObjectPtr<UClass>> NativeClasses;
+	TMap<FName, TWeakObjectPtr<UScriptStruct>> NativeStructs;
+	TMap<FName, TWeakObjectPtr<UEnum>> NativeEnums;
+	FRWLock NativeTypesLock;
+	
+	int32 TypeCacheGeneration = 0;
 	
 	FOnNewClass OnNewClass;
 	FOnNewStruct OnNewStruct;
@@ -7,3 +7,8 @@ void FCSArrayPropertyMetaData::SerializeFromJson(const TSharedPtr<FJsonObject>&
 	FCSUnrealType::SerializeFromJson(JsonObject);
 	FCSMetaDataUtils::SerializeProperty(JsonObject->GetObjectField(TEXT("InnerProperty")), InnerProperty);
 }
+
+SIZE_T FCSArrayPropertyMetaData::GetTotalSize() const
+{
+	return sizeof(*this) + InnerProperty.GetAllocatedSize();
+}
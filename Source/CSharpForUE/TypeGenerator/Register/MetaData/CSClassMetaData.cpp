@@ -46,3 +46,10 @@ void FCSClassMetaData::SerializeFromJson(const TSharedPtr<FJsonObject>& JsonObje
 		FCSMetaDataUtils::SerializeProperties(*FoundProperties, Properties);
 	}
 }
+
+SIZE_T FCSClassMetaData::GetAllocatedSize() const
+{
+	return FCSTypeReferenceMetaData::GetAllocatedSize() + ParentClass.GetAllocatedSize()
+		+ FCSMetaDataUtils::GetAllocatedSize(Properties) + FCSMetaDataUtils::GetAllocatedSize(Functions)
+		+ VirtualFunctions.GetAllocatedSize() + Interfaces.GetAllocatedSize();
+}
@@ -27,5 +27,6 @@ struct FCSClassMetaData : public FCSTypeReferenceMetaData
 
 	// FTypeReferenceMetaData interface implementation
 	virtual void SerializeFromJson(const TSharedPtr<FJsonObject>& JsonObject) override;
+	virtual SIZE_T GetAllocatedSize() const override;
 	// End of implementation
 };
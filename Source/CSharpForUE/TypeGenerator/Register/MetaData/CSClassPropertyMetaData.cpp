@@ -6,3 +6,8 @@ void FCSClassPropertyMetaData::SerializeFromJson(const TSharedPtr<FJsonObject>&
 	TypeRef.SerializeFromJson(JsonObject->GetObjectField(TEXT("InnerType")));
 }
 
+
+SIZE_T FCSClassPropertyMetaData::GetTotalSize() const
+{
+	return sizeof(*this) + TypeRef.GetAllocatedSize();
+}
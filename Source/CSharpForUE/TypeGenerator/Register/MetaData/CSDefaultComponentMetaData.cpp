@@ -16,4 +16,9 @@ void FCSDefaultComponentMetaData::SerializeFromJson(const TSharedPtr<FJsonObject
 	{
 		AttachmentSocket = *AttachmentSocketStr;
 	}
-}
\ No newline at end of file
+}
+
+SIZE_T FCSDefaultComponentMetaData::GetTotalSize() const
+{
+	return sizeof(*this) + InnerType.GetAllocatedSize();
+}
@@ -5,4 +5,9 @@ void FCSDelegateMetaData::SerializeFromJson(const TSharedPtr<FJsonObject>& JsonO
 	FCSUnrealType::SerializeFromJson(JsonObject);
 	SignatureFunction.SerializeFromJson(JsonObject->GetObjectField(TEXT("Signature")));
 	SignatureFunction.Name = "";
-}
\ No newline at end of file
+}
+
+SIZE_T FCSDelegateMetaData::GetTotalSize() const
+{
+	return sizeof(*this) + SignatureFunction.GetAllocatedSize();
+}
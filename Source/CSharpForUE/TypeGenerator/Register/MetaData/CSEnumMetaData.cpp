@@ -12,4 +12,9 @@ void FCSEnumMetaData::SerializeFromJson(const TSharedPtr<FJsonObject>& JsonObjec
 			Items.Add(*Item->AsString());
 		}
 	}
-}
\ No newline at end of file
+}
+
+SIZE_T FCSEnumMetaData::GetAllocatedSize() const
+{
+	return FCSTypeReferenceMetaData::GetAllocatedSize() + Items.GetAllocatedSize();
+}
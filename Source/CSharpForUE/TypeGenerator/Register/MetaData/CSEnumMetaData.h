@@ -10,5 +10,6 @@ struct FCSEnumMetaData : public FCSTypeReferenceMetaData
 
 	//FTypeMetaData interface implementation
 	virtual void SerializeFromJson(const TSharedPtr<FJsonObject>& JsonObject) override;
+	virtual SIZE_T GetAllocatedSize() const override;
 	//End of implementation
 };
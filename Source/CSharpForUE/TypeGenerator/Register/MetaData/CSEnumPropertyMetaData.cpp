@@ -4,4 +4,9 @@ void FCSEnumPropertyMetaData::SerializeFromJson(const TSharedPtr<FJsonObject>& J
 {
 	FCSUnrealType::SerializeFromJson(JsonObject);
 	InnerProperty.SerializeFromJson(JsonObject->GetObjectField(TEXT("InnerProperty")));
-}
\ No newline at end of file
+}
+
+SIZE_T FCSEnumPropertyMetaData::GetTotalSize() const
+{
+	return sizeof(*this) + InnerProperty.GetAllocatedSize();
+}
@@ -11,5 +11,6 @@ struct FCSEnumPropertyMetaData : FCSUnrealType
 
 	// FUnrealType interface implementation
 	virtual void SerializeFromJson(const TSharedPtr<FJsonObject>& JsonObject) override;
+	virtual SIZE_T GetTotalSize() const override;
 	// End of implementation
 };
@@ -24,3 +24,8 @@ void FCSFunctionMetaData::SerializeFromJson(const TSharedPtr<FJsonObject>& JsonO
 	JsonObject->TryGetBoolField(TEXT("IsVirtual"), IsVirtual);
 	FunctionFlags = FCSMetaDataUtils::GetFlags<EFunctionFlags>(JsonObject,"FunctionFlags");
 }
+
+SIZE_T FCSFunctionMetaData::GetAllocatedSize() const
+{
+	return FCSMemberMetaData::GetAllocatedSize() + FCSMetaDataUtils::GetAllocatedSize(Parameters) + ReturnValue.GetAllocatedSize();
+}
@@ -14,5 +14,6 @@ struct FCSFunctionMetaData : FCSMemberMetaData
 
 	//FTypeMetaData interface implementation
 	virtual void SerializeFromJson(const TSharedPtr<FJsonObject>& JsonObject) override;
+	virtual SIZE_T GetAllocatedSize() const override;
 	//End of implementation
 };
@@ -7,3 +7,8 @@ void FCSInterfaceMetaData::SerializeFromJson(const TSharedPtr<FJsonObject>& Json
 	FCSTypeReferenceMetaData::SerializeFromJson(JsonObject);
 	FCSMetaDataUtils::SerializeFunctions(JsonObject->GetArrayField(TEXT("Functions")), Functions);
 }
+
+SIZE_T FCSInterfaceMetaData::GetAllocatedSize() const
+{
+	return FCSTypeReferenceMetaData::GetAllocatedSize() + FCSMetaDataUtils::GetAllocatedSize(Functions);
+}
@@ -8,3 +8,8 @@ void FCSMapPropertyMetaData::SerializeFromJson(const TSharedPtr<FJsonObject>& Js
 	FCSMetaDataUtils::SerializeProperty(JsonObject->GetObjectField(TEXT("InnerProperty")), KeyType);
 	FCSMetaDataUtils::SerializeProperty(JsonObject->GetObjectField(TEXT("ValueProperty")), ValueType);
 }
+
+SIZE_T FCSMapPropertyMetaData::GetTotalSize() const
+{
+	return sizeof(*this) + KeyType.GetAllocatedSize() + ValueType.GetAllocatedSize();
+}
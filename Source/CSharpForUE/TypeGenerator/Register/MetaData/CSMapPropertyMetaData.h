@@ -10,5 +10,6 @@ struct FCSMapPropertyMetaData : public FCSUnrealType
 
 	// FTypeMetaData interface implementation
 	virtual void SerializeFromJson(const TSharedPtr<FJsonObject>& JsonObject) override;
+	virtual SIZE_T GetTotalSize() const override;
 	// End of implementation
 };
@@ -4,5 +4,17 @@
 void FCSMemberMetaData::SerializeFromJson(const TSharedPtr<FJsonObject>& JsonObject)
 {
 	Name = *JsonObject->GetStringField(TEXT("Name"));
+	
+#if WITH_EDITOR
 	FCSMetaDataUtils::SerializeFromJson(JsonObject, MetaData);
+#endif
+}
+
+SIZE_T FCSMemberMetaData::GetAllocatedSize() const
+{
+#if WITH_EDITOR
+	return FCSMetaDataUtils::GetAllocatedSize(MetaData);
+#else
+	return 0;
+#endif
 }
@@ -5,7 +5,14 @@ struct FCSMemberMetaData
 	virtual ~FCSMemberMetaData() = default;
 
 	FName Name;
+
+	// Only applied to fields in the editor, so it isn't kept at all in other builds.
+#if WITH_EDITOR
 	TMap<FString, FString> MetaData;
+#endif
 	
-	virtual void SerializeFromJson(const TSharedPtr<FJsonObject>& JsonObject);;
+	virtual void SerializeFromJson(const TSharedPtr<FJsonObject>& JsonObject);
+
+	// Heap memory owned by this metadata, for the metadata memory report.
+	virtual SIZE_T GetAllocatedSize() const;
 };
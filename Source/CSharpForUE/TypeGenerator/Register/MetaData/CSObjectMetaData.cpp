@@ -4,4 +4,9 @@ void FCSObjectMetaData::SerializeFromJson(const TSharedPtr<FJsonObject>& JsonObj
 {
 	FCSUnrealType::SerializeFromJson(JsonObject);
 	InnerType.SerializeFromJson(JsonObject->GetObjectField(TEXT("InnerType")));
-}
\ No newline at end of file
+}
+
+SIZE_T FCSObjectMetaData::GetTotalSize() const
+{
+	return sizeof(*this) + InnerType.GetAllocatedSize();
+}
@@ -8,8 +8,11 @@ void FCSPropertyMetaData:: SerializeFromJson(const TSharedPtr<FJsonObject>& Json
 	PropertyFlags = FCSMetaDataUtils::GetFlags<EPropertyFlags>(JsonObject,"PropertyFlags");
 	LifetimeCondition = FCSMetaDataUtils::GetFlags<ELifetimeCondition>(JsonObject,"LifetimeCondition");
 	
+#if WITH_EDITOR
 	JsonObject->TryGetStringField(TEXT("BlueprintGetter"), BlueprintGetter);
 	JsonObject->TryGetStringField(TEXT("BlueprintSetter"), BlueprintSetter);
+#endif
+	
 	JsonObject->TryGetBoolField(TEXT("IsArray"), IsArray);
 
 	FString RepNotifyFunctionNameStr;
@@ -18,3 +21,19 @@ void FCSPropertyMetaData:: SerializeFromJson(const TSharedPtr<FJsonObject>& Json
 		RepNotifyFunctionName = *RepNotifyFunctionNameStr;
 	}
 }
+
+SIZE_T FCSPropertyMetaData::GetAllocatedSize() const
+{
+	SIZE_T Size = FCSMemberMetaData::GetAllocatedSize();
+
+	if (Type.IsValid())
+	{
+		Size += Type->GetTotalSize();
+	}
+
+#if WITH_EDITOR
+	Size += BlueprintSetter.GetAllocatedSize() + BlueprintGetter.GetAllocatedSize();
+#endif
+	
+	return Size;
+}
@@ -12,13 +12,16 @@ struct FCSPropertyMetaData : FCSMemberMetaData
 	EPropertyFlags PropertyFlags;
 	ELifetimeCondition LifetimeCondition;
 
+#if WITH_EDITOR
 	FString BlueprintSetter;
 	FString BlueprintGetter;
+#endif
 
 	bool IsArray = false;
 
 	//FTypeMetaData interface implementation
 	virtual void SerializeFromJson(const TSharedPtr<FJsonObject>& JsonObject) override;
+	virtual SIZE_T GetAllocatedSize() const override;
 	//End of implementation
 
 	template<typename T>
@@ -8,4 +8,9 @@ void FCSStructMetaData::SerializeFromJson(const TSharedPtr<FJsonObject>& JsonObj
 	{
 		FCSMetaDataUtils::SerializeProperties(*FoundProperties, Properties);
 	}
-}
\ No newline at end of file
+}
+
+SIZE_T FCSStructMetaData::GetAllocatedSize() const
+{
+	return FCSTypeReferenceMetaData::GetAllocatedSize() + FCSMetaDataUtils::GetAllocatedSize(Properties);
+}
@@ -11,5 +11,6 @@ struct FCSStructMetaData : FCSTypeReferenceMetaData
 
 	//FTypeMetaData interface implementation
 	virtual void SerializeFromJson(const TSharedPtr<FJsonObject>& JsonObject) override;
+	virtual SIZE_T GetAllocatedSize() const override;
 	//End of implementation
 };
@@ -4,4 +4,9 @@ void FCSStructPropertyMetaData::SerializeFromJson(const TSharedPtr<FJsonObject>&
 {
 	FCSUnrealType::SerializeFromJson(JsonObject);
 	TypeRef.SerializeFromJson(JsonObject->GetObjectField(TEXT("InnerType")));
-}
\ No newline at end of file
+}
+
+SIZE_T FCSStructPropertyMetaData::GetTotalSize() const
+{
+	return sizeof(*this) + TypeRef.GetAllocatedSize();
+}
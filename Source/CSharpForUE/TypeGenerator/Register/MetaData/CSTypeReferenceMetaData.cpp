@@ -17,6 +17,17 @@ void FCSTypeReferenceMetaData::SerializeFromJson(const TSharedPtr<FJsonObject>&
 	{
 		AssemblyName = *AssemblyNameStr;
 	}
-	
+
+#if WITH_EDITOR
 	FCSMetaDataUtils::SerializeFromJson(JsonObject, MetaData);
+#endif
+}
+
+SIZE_T FCSTypeReferenceMetaData::GetAllocatedSize() const
+{
+#if WITH_EDITOR
+	return FCSMetaDataUtils::GetAllocatedSize(MetaData);
+#else
+	return 0;
+#endif
 }
@@ -8,7 +8,12 @@ struct FCSTypeReferenceMetaData
 	FName Namespace;
 	FName AssemblyName;
 
+#if WITH_EDITOR
 	TMap<FString, FString> MetaData;
+#endif
 	
 	virtual void SerializeFromJson(const TSharedPtr<FJsonObject>& JsonObject);
+
+	// Heap memory owned by this metadata, for the metadata memory report.
+	virtual SIZE_T GetAllocatedSize() const;
 };
@@ -13,5 +13,8 @@ struct FCSUnrealType
 	// Begin FCSUnrealType
 	virtual void SerializeFromJson(const TSharedPtr<FJsonObject>& JsonObject);
 	virtual void OnPropertyCreated(FProperty* Property) {};
+	
+	// Size of this metadata including the memory it owns, for the metadata memory report.
+	virtual SIZE_T GetTotalSize() const { return sizeof(*this); }
 	// End FCSUnrealType
 };
@@ -1,5 +1,7 @@
 ﻿#pragma once
 
+#include "CSharpForUE/CSStartupTimings.h"
+
 template<typename TMetaData, typename TField, typename TTypeBuilder>
 struct CSHARPFORUE_API TCSharpTypeInfo
 {
@@ -9,6 +11,7 @@ struct CSHARPFORUE_API TCSharpTypeInfo
 	{
 		TypeMetaData = MakeShared<TMetaData>();
 		TypeMetaData->SerializeFromJson(MetaData->AsObject());
+		AssemblyName = TypeMetaData->AssemblyName;
 	}
 
 	TCSharpTypeInfo() : Field(nullptr) {}
@@ -19,6 +22,12 @@ struct CSHARPFORUE_API TCSharpTypeInfo
 	// Pointer to the field of this type
 	TField* Field;
 
+	// Kept separately, the metadata is released once the type is built outside the editor.
+	FName AssemblyName;
+
+	// Set on hot reload when neither this type nor the managed types it depends on changed their layout.
+	bool bLayoutUnchanged = false;
+
 	virtual TField* InitializeBuilder()
 	{
 		if (Field)
@@ -27,8 +36,41 @@ struct CSHARPFORUE_API TCSharpTypeInfo
 		}
 		
 		TTypeBuilder TypeBuilder = TTypeBuilder(TypeMetaData);
+
+		if (bLayoutUnchanged)
+		{
+			Field = TypeBuilder.TryReuseExistingType();
+
+			if (Field)
+			{
+				ReleaseBuilderData();
+				return Field;
+			}
+		}
+		
+		const double StartTime = FPlatformTime::Seconds();
+		
 		Field = TypeBuilder.CreateType();
 		TypeBuilder.StartBuildingType();
+
+		FCSStartupTimings::AddTypeBuildTime(TypeMetaData->Name, FPlatformTime::Seconds() - StartTime);
+		ReleaseBuilderData();
 		return Field;
 	}
+
+	// Memory held by the metadata of this type, zero once it has been released.
+	SIZE_T GetMetaDataSize() const
+	{
+		return TypeMetaData.IsValid() ? sizeof(TMetaData) + TypeMetaData->GetAllocatedSize() : 0;
+	}
+
+protected:
+
+	// Nothing reads the metadata once the field exists, except the editor which shows and rebuilds types from it.
+	void ReleaseBuilderData()
+	{
+#if !WITH_EDITOR
+		TypeMetaData.Reset();
+#endif
+	}
 };
@@ -6,11 +6,13 @@
 #include "CSPropertyTranslatorManager.h"
 #include "PropertyTranslators/PropertyTranslator.h"
 #include "PropertyTranslators/DelegateBasePropertyTranslator.h"
+#include "PropertyTranslators/BlittableStructPropertyTranslator.h"
 #include "GameFramework/FloatingPawnMovement.h"
 #include "GameFramework/SpringArmComponent.h"
 #include "Interfaces/IPluginManager.h"
 #include "Kismet/KismetMathLibrary.h"
 #include "Kismet2/KismetEditorUtilities.h"
+#include "Misc/FileHelper.h"
 #include "Misc/ScopedSlowTask.h"
 #include "PhysicsEngine/PhysicsAsset.h"
 #include "UnrealSharpUtilities/UnrealSharpStatics.h"
@@ -28,6 +30,9 @@ void FCSGenerator::StartGenerator(const FString& OutputDirectory)
 	GeneratedScriptsDirectory = OutputDirectory;
 
 	CheckGlueGeneratorVersion();
+	GlueManifest.Load(GeneratedScriptsDirectory);
+
+	GConfig->GetBool(GLUE_GENERATOR_CONFIG, GLUE_GENERATOR_STRUCT_VIEWS_KEY, bGenerateStructViews, GEditorPerProjectIni);
 
 	//TODO: SUPPORT THESE BUT CURRENTLY TOO LAZY TO FIX
 	{
@@ -47,6 +52,11 @@ void FCSGenerator::StartGenerator(const FString& OutputDirectory)
 
 	PropertyTranslatorManager.Reset(new FCSPropertyTranslatorManager(NameMapper, DenyList));
 
+	// After the translators, which deny the structs they handle themselves.
+	// The struct view setting changes the output of every struct too, so it's hashed along with the lists.
+	const uint64 InclusionListHashes[] = { AllowList.ComputeHash(), DenyList.ComputeHash(), BlueprintInternalAllowList.ComputeHash(), OverrideInternalList.ComputeHash(), static_cast<uint64>(bGenerateStructViews) };
+	GlueManifest.SetInclusionListsHash(FXxHash64::HashBuffer(InclusionListHashes, sizeof(InclusionListHashes)).Hash);
+
 	FModuleManager::Get().OnModulesChanged().AddRaw(this, &FCSGenerator::OnModulesChanged);
 
 	// Get all currently loaded types that are in the engine
@@ -62,6 +72,10 @@ void FCSGenerator::StartGenerator(const FString& OutputDirectory)
 	GenerateGlueForType(UObject::StaticClass(), true);
 	GenerateGlueForType(USpringArmComponent::StaticClass(), true);
 	GenerateGlueForType(UFloatingPawnMovement::StaticClass(), true);
+
+	GlueManifest.Save();
+	SaveBlittableStructReport();
+	UE_LOG(LogGlueGenerator, Log, TEXT("Skipped glue generation for %d unchanged types."), NumUnchangedTypes);
 }
 
 void FCSGenerator::GenerateGlueForPackage(const UPackage* Package)
@@ -92,6 +106,7 @@ void FCSGenerator::OnModulesChanged(FName InModuleName, EModuleChangeReason InMo
 	}
 
 	GenerateGlueForPackage(ModulePackage);
+	GlueManifest.Save();
 }
 
 #define LOCTEXT_NAMESPACE "FScriptGenerator"
@@ -107,6 +122,7 @@ void FCSGenerator::GenerateGlueForTypes(TArray<UObject*>& ObjectsToProcess)
 	}
 	
 	GeneratedFileManager.RenameTempFiles();
+	GlueManifest.Save();
 	SlowTask.EnterProgressFrame(1);
 }
 
@@ -163,29 +179,61 @@ void FCSGenerator::GenerateGlueForType(UObject* Object, bool bForceExport)
 		}
 		
 		RegisterClassToModule(Class);
+
+		const bool bIsInterface = Class->IsChildOf(UInterface::StaticClass());
+		
+		if (!bIsInterface && !bForceExport && !ShouldExportClass(Class) && !GlueManifest.HasEntry(Class))
+		{
+			return;
+		}
+
+		if (IsGlueUpToDate(Class))
+		{
+			SkipUnchangedClass(Class);
+			return;
+		}
 				
-		if (Class->IsChildOf(UInterface::StaticClass()))
+		if (bIsInterface)
 		{
 			ExportInterface(Class, Builder);
 		}
-		else if (bForceExport || ShouldExportClass(Class))
+		else
 		{
 			ExportClass(Class, Builder);
 		}
 	}
 	else if (UScriptStruct* Struct = Cast<UScriptStruct>(Object))
 	{
-		if (bForceExport || ShouldExportStruct(Struct))
+		if (!bForceExport && !ShouldExportStruct(Struct) && !GlueManifest.HasEntry(Struct))
 		{
-			ExportStruct(Struct, Builder);
+			return;
 		}
+
+		if (IsGlueUpToDate(Struct))
+		{
+			SkipUnchangedType(Struct);
+
+			// The report lists every struct, not just the ones generated this run.
+			AddToBlittableStructReport(Struct, FBlittableStructPropertyTranslator::AnalyzeStructLayout(*PropertyTranslatorManager, *Struct));
+			return;
+		}
+		
+		ExportStruct(Struct, Builder);
 	}
 	else if (UEnum* Enum = Cast<UEnum>(Object))
 	{
-		if (bForceExport || ShouldExportEnum(Enum))
+		if (!bForceExport && !ShouldExportEnum(Enum) && !GlueManifest.HasEntry(Enum))
 		{
-			ExportEnum(Enum, Builder);
+			return;
 		}
+
+		if (IsGlueUpToDate(Enum))
+		{
+			SkipUnchangedType(Enum);
+			return;
+		}
+		
+		ExportEnum(Enum, Builder);
 	}
 
 	if (Builder.IsEmpty())
@@ -194,6 +242,46 @@ void FCSGenerator::GenerateGlueForType(UObject* Object, bool bForceExport)
 	}
 	
 	SaveTypeGlue(Object->GetOutermost(), Object->GetName(), Builder);
+	GlueManifest.UpdateEntry(Object, GlueManifest.ComputeTypeHash(Object));
+}
+
+bool FCSGenerator::IsGlueUpToDate(const UObject* Object)
+{
+	const FCSModule& Module = FindOrRegisterModule(Object->GetOutermost());
+	const FString GlueOutputPath = FPaths::Combine(Module.GetGeneratedSourceDirectory(), FString::Printf(TEXT("%s.generated.cs"), *Object->GetName()));
+
+	return GlueManifest.IsUpToDate(Object, GlueManifest.ComputeTypeHash(Object), GlueOutputPath);
+}
+
+void FCSGenerator::SkipUnchangedType(UObject* Object)
+{
+	// Counted once, later requests for the type stop at ExportedTypes like they do for generated ones.
+	ExportedTypes.Add(Object);
+	++NumUnchangedTypes;
+}
+
+void FCSGenerator::SkipUnchangedClass(UClass* Class)
+{
+	SkipUnchangedType(Class);
+
+	if (Class->IsChildOf(UInterface::StaticClass()))
+	{
+		return;
+	}
+
+	// Keep the side effects of ExportClass that other glue depends on.
+	if (UClass* SuperClass = Class->GetSuperClass())
+	{
+		GenerateGlueForType(SuperClass, true);
+	}
+
+	if (Class->IsChildOf(UBlueprintFunctionLibrary::StaticClass()))
+	{
+		TSet<UFunction*> ExportedFunctions;
+		TSet<UFunction*> ExportedOverridableFunctions;
+		GetExportedFunctions(ExportedFunctions, ExportedOverridableFunctions, Class);
+		GatherExtensionMethods(Class, ExportedFunctions);
+	}
 }
 
 void FCSGenerator::GenerateGlueForDelegate(UFunction* DelegateSignature, bool bForceExport)
@@ -822,6 +910,8 @@ void FCSGenerator::ExportClassOverridableFunctions(FCSScriptBuilder& Builder, co
 
 void FCSGenerator::ExportClassFunctions(FCSScriptBuilder& Builder, const UClass* Class, const TSet<UFunction*>& ExportedFunctions)
 {
+	GatherExtensionMethods(Class, ExportedFunctions);
+	
 	for (UFunction* Function : ExportedFunctions)
 	{
 		FPropertyTranslator::FunctionType FuncType = FPropertyTranslator::FunctionType::Normal;
@@ -831,18 +921,31 @@ void FCSGenerator::ExportClassFunctions(FCSScriptBuilder& Builder, const UClass*
 			FuncType = FPropertyTranslator::FunctionType::InternalWhitelisted;
 		}
 		
-		if (Function->HasAnyFunctionFlags(FUNC_Static) && Class->IsChildOf(UBlueprintFunctionLibrary::StaticClass()))
+		PropertyTranslatorManager->Find(Function).ExportFunction(Builder, Function, FuncType);
+	}
+}
+
+void FCSGenerator::GatherExtensionMethods(const UClass* Class, const TSet<UFunction*>& ExportedFunctions)
+{
+	if (!Class->IsChildOf(UBlueprintFunctionLibrary::StaticClass()))
+	{
+		return;
+	}
+	
+	for (UFunction* Function : ExportedFunctions)
+	{
+		if (!Function->HasAnyFunctionFlags(FUNC_Static))
 		{
-			ExtensionMethod Method;
-			if (GetExtensionMethodInfo(Method, Function))
-			{
-				const FCSModule& BindingsModule = FindOrRegisterModule(Class);
-				TArray<ExtensionMethod>& ModuleExtensionMethods = ExtensionMethods.FindOrAdd(BindingsModule.GetModuleName());
-				ModuleExtensionMethods.Add(Method);
-			}
+			continue;
 		}
 		
-		PropertyTranslatorManager->Find(Function).ExportFunction(Builder, Function, FuncType);
+		ExtensionMethod Method;
+		if (GetExtensionMethodInfo(Method, Function))
+		{
+			const FCSModule& BindingsModule = FindOrRegisterModule(Class);
+			TArray<ExtensionMethod>& ModuleExtensionMethods = ExtensionMethods.FindOrAdd(BindingsModule.GetModuleName());
+			ModuleExtensionMethods.Add(Method);
+		}
 	}
 }
 
@@ -1083,7 +1186,11 @@ void FCSGenerator::ExportStruct(UScriptStruct* Struct, FCSScriptBuilder& Builder
 	
 	Builder.GenerateScriptSkeleton(BindingsModule.GetNamespace());
 
-	const bool bIsBlittable = PropertyTranslatorManager->IsStructBlittable(*Struct);
+	const FCSBlittableStructLayout Layout = FBlittableStructPropertyTranslator::AnalyzeStructLayout(*PropertyTranslatorManager, *Struct);
+	const bool bIsBlittable = Layout.bIsBlittable;
+
+	// Every exported member of a blittable struct is mirrored, the layout analysis keeps structs with members it can't mirror marshalled.
+	AddToBlittableStructReport(Struct, Layout);
 	
 	FCSPropertyBuilder PropBuilder;
 
@@ -1098,6 +1205,13 @@ void FCSGenerator::ExportStruct(UScriptStruct* Struct, FCSScriptBuilder& Builder
 
 	AppendTooltip(Struct, Builder);
 	Builder.AppendLine(PropBuilder.ToString());
+
+	if (bIsBlittable)
+	{
+		// Mirror the native layout exactly, padding and hidden members included, so the struct can be copied as is.
+		Builder.AppendLine(FString::Printf(TEXT("[StructLayout(LayoutKind.Explicit, Size = %d)]"), Struct->GetStructureSize()));
+	}
+	
 	Builder.DeclareType("struct", NameMapper.GetStructScriptName(Struct));
 
 	TSet<FString> ReservedNames;
@@ -1118,6 +1232,13 @@ void FCSGenerator::ExportStruct(UScriptStruct* Struct, FCSScriptBuilder& Builder
 		// Generate native constructor
 		Builder.AppendLine();
 		ExportMirrorStructMarshalling(Builder, Struct, ExportedProperties, ReservedNames);
+
+		// Generate a view that reads fields in place
+		if (ShouldExportStructView(Struct))
+		{
+			Builder.AppendLine();
+			ExportStructView(Builder, Struct, ExportedProperties, ReservedNames);
+		}
 	}
 	
 	Builder.CloseBrace();
@@ -1163,6 +1284,25 @@ void FCSGenerator::ExportStructMarshaller(FCSScriptBuilder& Builder, const UScri
 	Builder.OpenBrace();
 	Builder.AppendLine(FString::Printf(TEXT("return %s.NativeDataSize;"), *StructName));
 	Builder.CloseBrace();
+
+	if (!ShouldExportStructView(Struct))
+	{
+		Builder.CloseBrace();
+		return;
+	}
+
+	Builder.AppendLine();
+	Builder.AppendLine(FString::Printf(TEXT("public static %s.%sView ViewFromNative(IntPtr nativeBuffer, int arrayIndex)"), *StructName, *StructName));
+	Builder.OpenBrace();
+	Builder.AppendLine(FString::Printf(TEXT("return new %s.%sView(nativeBuffer + arrayIndex * GetNativeDataSize());"), *StructName, *StructName));
+	Builder.CloseBrace();
+
+	Builder.AppendLine();
+	Builder.AppendLine("// Reads an element of a native array in place, instead of copying the whole struct out.");
+	Builder.AppendLine(FString::Printf(TEXT("public static %s.%sView GetView(this UnrealArrayBase<%s> array, int index)"), *StructName, *StructName, *StructName));
+	Builder.OpenBrace();
+	Builder.AppendLine(FString::Printf(TEXT("return new %s.%sView(array.GetElementAddress(index, GetNativeDataSize()));"), *StructName, *StructName));
+	Builder.CloseBrace();
 	Builder.CloseBrace();
 }
 
@@ -1217,6 +1357,106 @@ void FCSGenerator::ExportMirrorStructMarshalling(FCSScriptBuilder& Builder, cons
 	Builder.CloseBrace(); // ToNative
 }
 
+bool FCSGenerator::ShouldExportStructView(const UScriptStruct* Struct) const
+{
+	return bGenerateStructViews || Struct->HasMetaData(TEXT("GenerateView"));
+}
+
+void FCSGenerator::ExportStructView(FCSScriptBuilder& Builder, const UScriptStruct* Struct, const TSet<FProperty*>& ExportedProperties, const TSet<FString>& ReservedNames) const
+{
+	const FString StructName = NameMapper.GetStructScriptName(Struct);
+	
+	Builder.AppendLine("// A view over a native instance of this struct. Fields are marshalled when they're accessed instead of all at once.");
+	Builder.AppendLine("// The view doesn't keep the native memory alive, so don't hold on to it past the owner's lifetime.");
+	Builder.AppendLine(FString::Printf(TEXT("public readonly ref struct %sView"), *StructName));
+	Builder.OpenBrace();
+	
+	Builder.AppendLine("public readonly IntPtr NativeStruct;");
+	Builder.AppendLine();
+	Builder.AppendLine(FString::Printf(TEXT("public %sView(IntPtr nativeStruct)"), *StructName));
+	Builder.OpenBrace();
+	Builder.AppendLine("NativeStruct = nativeStruct;");
+	Builder.CloseBrace();
+	
+	Builder.AppendLine();
+	Builder.AppendLine("// Copies the whole struct out of native memory.");
+	Builder.AppendLine(FString::Printf(TEXT("public %s ToManaged() => new %s(NativeStruct);"), *StructName, *StructName));
+
+	for (const FProperty* Property : ExportedProperties)
+	{
+		const FPropertyTranslator& PropertyHandler = PropertyTranslatorManager->Find(Property);
+		FString NativePropertyName = Property->GetName();
+		FString CSharpPropertyName = NameMapper.MapPropertyName(Property, ReservedNames);
+		FString Offset = FString::Printf(TEXT("%s_Offset"), *NativePropertyName);
+		
+		FString Protection;
+		FPropertyTranslator::GetPropertyProtection(Property, Protection);
+
+		Builder.AppendLine();
+		Builder.AppendLine(FString::Printf(TEXT("%s%s %s"), *Protection, *PropertyHandler.GetManagedType(Property), *CSharpPropertyName));
+		Builder.OpenBrace();
+		
+		Builder.AppendLine("get");
+		Builder.OpenBrace();
+		Builder.BeginUnsafeBlock();
+		PropertyHandler.ExportMarshalFromNativeBuffer(Builder, Property, NativePropertyName, "return", "NativeStruct", Offset, false, false);
+		Builder.EndUnsafeBlock();
+		Builder.CloseBrace(); // get
+		
+		Builder.AppendLine("set");
+		Builder.OpenBrace();
+		Builder.BeginUnsafeBlock();
+		PropertyHandler.ExportMarshalToNativeBuffer(Builder, Property, NativePropertyName, "NativeStruct", Offset, "value");
+		Builder.EndUnsafeBlock();
+		Builder.CloseBrace(); // set
+		
+		Builder.CloseBrace();
+	}
+	
+	Builder.CloseBrace(); // View
+}
+
+void FCSGenerator::AddToBlittableStructReport(const UScriptStruct* Struct, const FCSBlittableStructLayout& Layout)
+{
+	if (!Layout.bIsBlittable || !Layout.RequiresExtendedLayout())
+	{
+		return;
+	}
+	
+	FString Details = FString::Printf(TEXT("%s (%d bytes, %d bytes of padding)"), *Struct->GetPathName(), Struct->GetStructureSize(), Layout.PaddingBytes);
+		
+	if (!Layout.HiddenMembers.IsEmpty())
+	{
+		Details += FString::Printf(TEXT(", hidden: %s"), *FString::JoinBy(Layout.HiddenMembers, TEXT(", "), UE_PROJECTION_MEMBER(FName, ToString)));
+	}
+		
+	if (!Layout.ExtendedNestedStructs.IsEmpty())
+	{
+		Details += FString::Printf(TEXT(", nested: %s"), *FString::JoinBy(Layout.ExtendedNestedStructs, TEXT(", "), UE_PROJECTION_MEMBER(FName, ToString)));
+	}
+		
+	ExtendedBlittableStructs.Add(MoveTemp(Details));
+}
+
+void FCSGenerator::SaveBlittableStructReport() const
+{
+	const FString ReportPath = FPaths::Combine(GeneratedScriptsDirectory, TEXT("BlittableStructs.txt"));
+	
+	if (ExtendedBlittableStructs.IsEmpty())
+	{
+		// Don't leave a report from an earlier run behind.
+		IFileManager::Get().Delete(*ReportPath, false, false, true);
+		return;
+	}
+
+	TArray<FString> SortedStructs = ExtendedBlittableStructs;
+	SortedStructs.Sort();
+	
+	FFileHelper::SaveStringArrayToFile(SortedStructs, *ReportPath);
+	
+	UE_LOG(LogGlueGenerator, Log, TEXT("%d structs marshal by memcpy thanks to the padding-aware layout analysis. See %s"), SortedStructs.Num(), *ReportPath);
+}
+
 FString FCSGenerator::GetSuperClassName(const UClass* Class) const
 {
 	if (Class == UObject::StaticClass())
@@ -4,10 +4,13 @@
 #include "CSNameMapper.h"
 #include "CSModule.h"
 #include "CSGlueGeneratorFileManager.h"
+#include "CSGlueManifest.h"
 #include "CSInclusionLists.h"
 #include "CSPropertyTranslatorManager.h"
 #include "UObject/Stack.h"
 
+struct FCSBlittableStructLayout;
+
 struct ExtensionMethod
 {
 	UClass* OverrideClassBeingExtended;
@@ -48,6 +51,10 @@ public:
 	void GetExportedStructs(TSet<UScriptStruct*>& ExportedStructs) const;
 	
 	void ExportMirrorStructMarshalling(FCSScriptBuilder& Builder, const UScriptStruct* Struct, TSet<FProperty*> ExportedProperties, const TSet<FString>& ReservedNames) const;
+	void ExportStructView(FCSScriptBuilder& Builder, const UScriptStruct* Struct, const TSet<FProperty*>& ExportedProperties, const TSet<FString>& ReservedNames) const;
+
+	// Views are opt-in, either for every struct through the generator config or per struct with meta=(GenerateView).
+	bool ShouldExportStructView(const UScriptStruct* Struct) const;
 
 	void ExportClass(UClass* Class, FCSScriptBuilder& Builder);
 	void ExportStruct(UScriptStruct* Struct, FCSScriptBuilder& Builder);
@@ -84,6 +91,7 @@ public:
 	void ExportClassFunctionStaticConstruction(FCSScriptBuilder& Builder, const UFunction *Function);
 	void ExportDelegateFunctionStaticConstruction(FCSScriptBuilder& Builder, const UFunction *Function);
 	void ExportClassOverridableFunctions(FCSScriptBuilder& Builder, const TSet<UFunction*>& ExportedOverridableFunctions);
+	void GatherExtensionMethods(const UClass* Class, const TSet<UFunction*>& ExportedFunctions);
 	
 	static bool GetExtensionMethodInfo(ExtensionMethod& Info, UFunction* Function);
 
@@ -112,10 +120,12 @@ protected:
 	FString GeneratedScriptsDirectory;
 
 	bool bInitialized = false;
+	bool bGenerateStructViews = false;
 
 	TUniquePtr<FCSPropertyTranslatorManager> PropertyTranslatorManager;
 	FCSNameMapper NameMapper;
 	FCSGlueGeneratorFileManager GeneratedFileManager;
+	FCSGlueManifest GlueManifest;
 	
 	FCSInclusionLists AllowList;
 	FCSInclusionLists DenyList;
@@ -129,5 +139,17 @@ protected:
 private:
 
 	void CheckGlueGeneratorVersion() const;
+
+	/** Whether the glue on disk was generated from the current reflection data of this type. */
+	bool IsGlueUpToDate(const UObject* Object);
+	void SkipUnchangedType(UObject* Object);
+	void SkipUnchangedClass(UClass* Class);
+
+	/** Lists the structs that only marshal by memcpy because of padding, hidden members or nested structs like that. */
+	void AddToBlittableStructReport(const UScriptStruct* Struct, const FCSBlittableStructLayout& Layout);
+	void SaveBlittableStructReport() const;
+	
+	int32 NumUnchangedTypes = 0;
+	TArray<FString> ExtendedBlittableStructs;
 	TSet<UFunction*> ExportedDelegates;
 };
@@ -0,0 +1,337 @@
+#include "CSGlueManifest.h"
+#include "GlueGeneratorModule.h"
+#include "Misc/FileHelper.h"
+#include "UObject/MetaData.h"
+#include "UObject/UnrealType.h"
+
+static const TCHAR* GlueManifestFileName = TEXT("GlueManifest.txt");
+
+namespace
+{
+	void HashBytes(FXxHash64Builder& Builder, const void* Data, uint64 Size)
+	{
+		Builder.Update(Data, Size);
+	}
+
+	void HashString(FXxHash64Builder& Builder, const FString& String)
+	{
+		const int32 Length = String.Len();
+		HashBytes(Builder, &Length, sizeof(Length));
+		HashBytes(Builder, *String, Length * sizeof(TCHAR));
+	}
+
+	void HashName(FXxHash64Builder& Builder, FName Name)
+	{
+		HashString(Builder, Name.ToString());
+	}
+
+	template<typename T>
+	void HashValue(FXxHash64Builder& Builder, const T& Value)
+	{
+		HashBytes(Builder, &Value, sizeof(T));
+	}
+
+	void HashMetaDataMap(FXxHash64Builder& Builder, const TMap<FName, FString>* MetaDataMap)
+	{
+		const int32 Num = MetaDataMap ? MetaDataMap->Num() : 0;
+		HashValue(Builder, Num);
+
+		if (!MetaDataMap)
+		{
+			return;
+		}
+
+		for (const TPair<FName, FString>& MetaData : *MetaDataMap)
+		{
+			HashName(Builder, MetaData.Key);
+			HashString(Builder, MetaData.Value);
+		}
+	}
+
+	void HashDependency(FXxHash64Builder& Builder, const UObject* Dependency, TArray<const UObject*>& OutDependencies)
+	{
+		HashString(Builder, Dependency ? Dependency->GetPathName() : FString());
+
+		if (Dependency)
+		{
+			OutDependencies.AddUnique(Dependency);
+		}
+	}
+}
+
+void FCSGlueManifest::Load(const FString& InDirectory)
+{
+	ManifestPath = FPaths::Combine(InDirectory, GlueManifestFileName);
+	Entries.Reset();
+	bDirty = false;
+
+	TArray<FString> Lines;
+	if (!FFileHelper::LoadFileToStringArray(Lines, *ManifestPath))
+	{
+		return;
+	}
+
+	for (const FString& Line : Lines)
+	{
+		FString TypePath;
+		FString HashText;
+
+		if (!Line.Split(TEXT("\t"), &TypePath, &HashText))
+		{
+			continue;
+		}
+
+		Entries.Add(TypePath, FCString::Strtoui64(*HashText, nullptr, 16));
+	}
+}
+
+void FCSGlueManifest::Save()
+{
+	if (!bDirty || ManifestPath.IsEmpty())
+	{
+		return;
+	}
+
+	TArray<FString> Lines;
+	Lines.Reserve(Entries.Num());
+
+	for (const TPair<FString, uint64>& Entry : Entries)
+	{
+		Lines.Add(FString::Printf(TEXT("%s\t%016llx"), *Entry.Key, Entry.Value));
+	}
+
+	if (!FFileHelper::SaveStringArrayToFile(Lines, *ManifestPath))
+	{
+		UE_LOG(LogGlueGenerator, Warning, TEXT("Couldn't write glue manifest '%s'"), *ManifestPath);
+		return;
+	}
+
+	bDirty = false;
+}
+
+bool FCSGlueManifest::HasEntry(const UObject* Object) const
+{
+	return Entries.Contains(Object->GetPathName());
+}
+
+bool FCSGlueManifest::IsUpToDate(const UObject* Object, uint64 TypeHash, const FString& GlueOutputPath) const
+{
+	const uint64* FoundHash = Entries.Find(Object->GetPathName());
+
+	if (!FoundHash || *FoundHash != TypeHash)
+	{
+		return false;
+	}
+
+	// Someone could have cleaned the generated folder without touching the manifest.
+	return IFileManager::Get().FileExists(*GlueOutputPath);
+}
+
+void FCSGlueManifest::UpdateEntry(const UObject* Object, uint64 TypeHash)
+{
+	uint64& Hash = Entries.FindOrAdd(Object->GetPathName());
+
+	if (Hash != TypeHash)
+	{
+		Hash = TypeHash;
+		bDirty = true;
+	}
+}
+
+void FCSGlueManifest::SetInclusionListsHash(uint64 InInclusionListsHash)
+{
+	if (InclusionListsHash != InInclusionListsHash)
+	{
+		InclusionListsHash = InInclusionListsHash;
+		TypeHashCache.Reset();
+	}
+}
+
+uint64 FCSGlueManifest::ComputeTypeHash(const UObject* Object)
+{
+	if (const uint64* CachedHash = TypeHashCache.Find(Object))
+	{
+		return *CachedHash;
+	}
+
+	// Gather the type and everything it embeds, directly or not. Cycles end here since every type is visited once.
+	TSet<const UObject*> Closure;
+	TArray<const UObject*> Pending = { Object };
+
+	while (!Pending.IsEmpty())
+	{
+		const UObject* Current = Pending.Pop();
+
+		bool bAlreadyVisited;
+		Closure.Add(Current, &bAlreadyVisited);
+
+		if (!bAlreadyVisited)
+		{
+			Pending.Append(ComputeLocalTypeHash(Current).Dependencies);
+		}
+	}
+
+	// Sorted by path, so the hash doesn't depend on the order types were reached or hashed in.
+	TArray<TPair<FString, uint64>> LocalHashes;
+	LocalHashes.Reserve(Closure.Num());
+
+	for (const UObject* Type : Closure)
+	{
+		LocalHashes.Emplace(Type->GetPathName(), LocalTypeHashes.FindChecked(Type).Hash);
+	}
+
+	LocalHashes.Sort([](const TPair<FString, uint64>& A, const TPair<FString, uint64>& B)
+	{
+		return A.Key < B.Key;
+	});
+
+	FXxHash64Builder Builder;
+
+	const int32 GeneratorVersion = GLUE_GENERATOR_VERSION;
+	HashValue(Builder, GeneratorVersion);
+	HashValue(Builder, InclusionListsHash);
+	HashString(Builder, Object->GetPathName());
+
+	for (const TPair<FString, uint64>& LocalHash : LocalHashes)
+	{
+		HashString(Builder, LocalHash.Key);
+		HashValue(Builder, LocalHash.Value);
+	}
+
+	const uint64 Hash = Builder.Finalize().Hash;
+	TypeHashCache.Add(Object, Hash);
+	return Hash;
+}
+
+const FCSGlueManifest::FLocalTypeHash& FCSGlueManifest::ComputeLocalTypeHash(const UObject* Object)
+{
+	if (const FLocalTypeHash* CachedHash = LocalTypeHashes.Find(Object))
+	{
+		return *CachedHash;
+	}
+
+	FLocalTypeHash LocalHash;
+	FXxHash64Builder Builder;
+
+	HashString(Builder, Object->GetPathName());
+	HashName(Builder, Object->GetClass()->GetFName());
+	HashMetaDataMap(Builder, UMetaData::GetMapForObject(Object));
+
+	if (const UEnum* Enum = Cast<UEnum>(Object))
+	{
+		const int32 NumEnums = Enum->NumEnums();
+		HashValue(Builder, NumEnums);
+
+		for (int32 Index = 0; Index < NumEnums; ++Index)
+		{
+			HashName(Builder, Enum->GetNameByIndex(Index));
+			HashValue(Builder, Enum->GetValueByIndex(Index));
+		}
+	}
+	else if (const UStruct* Struct = Cast<UStruct>(Object))
+	{
+		HashStruct(Builder, Struct, LocalHash.Dependencies);
+	}
+
+	LocalHash.Hash = Builder.Finalize().Hash;
+	return LocalTypeHashes.Add(Object, MoveTemp(LocalHash));
+}
+
+void FCSGlueManifest::HashStruct(FXxHash64Builder& Builder, const UStruct* Struct, TArray<const UObject*>& OutDependencies)
+{
+	HashValue(Builder, Struct->GetStructureSize());
+
+	if (const UStruct* SuperStruct = Struct->GetSuperStruct())
+	{
+		// Structs inline the properties of their parent struct in the glue.
+		if (Struct->IsA<UScriptStruct>())
+		{
+			HashDependency(Builder, SuperStruct, OutDependencies);
+		}
+		else
+		{
+			HashString(Builder, SuperStruct->GetPathName());
+		}
+	}
+
+	if (const UClass* Class = Cast<UClass>(Struct))
+	{
+		HashValue(Builder, Class->ClassFlags);
+
+		for (const FImplementedInterface& Interface : Class->Interfaces)
+		{
+			HashString(Builder, Interface.Class->GetPathName());
+		}
+	}
+	else if (const UScriptStruct* ScriptStruct = Cast<UScriptStruct>(Struct))
+	{
+		HashValue(Builder, ScriptStruct->StructFlags);
+	}
+	else if (const UFunction* Function = Cast<UFunction>(Struct))
+	{
+		HashValue(Builder, Function->FunctionFlags);
+	}
+
+	for (TFieldIterator<FProperty> PropertyIt(Struct, EFieldIteratorFlags::ExcludeSuper); PropertyIt; ++PropertyIt)
+	{
+		HashProperty(Builder, *PropertyIt, OutDependencies);
+	}
+
+	for (TFieldIterator<UFunction> FunctionIt(Struct, EFieldIteratorFlags::ExcludeSuper); FunctionIt; ++FunctionIt)
+	{
+		HashFunction(Builder, *FunctionIt, OutDependencies);
+	}
+}
+
+void FCSGlueManifest::HashProperty(FXxHash64Builder& Builder, const FProperty* Property, TArray<const UObject*>& OutDependencies)
+{
+	HashName(Builder, Property->GetFName());
+	HashName(Builder, Property->GetClass()->GetFName());
+	HashString(Builder, Property->GetCPPType());
+	HashValue(Builder, Property->PropertyFlags);
+	HashValue(Builder, Property->ArrayDim);
+	HashValue(Builder, Property->ElementSize);
+	HashValue(Builder, Property->GetOffset_ForInternal());
+
+#if WITH_METADATA
+	HashMetaDataMap(Builder, Property->GetMetaDataMap());
+#endif
+
+	// Nested structs decide blittability and marshalling of the owning type.
+	if (const FStructProperty* StructProperty = CastField<FStructProperty>(Property))
+	{
+		HashDependency(Builder, StructProperty->Struct, OutDependencies);
+	}
+	else if (const FDelegateProperty* DelegateProperty = CastField<FDelegateProperty>(Property))
+	{
+		HashDependency(Builder, DelegateProperty->SignatureFunction, OutDependencies);
+	}
+	else if (const FMulticastDelegateProperty* MulticastDelegateProperty = CastField<FMulticastDelegateProperty>(Property))
+	{
+		HashDependency(Builder, MulticastDelegateProperty->SignatureFunction, OutDependencies);
+	}
+
+	TArray<FField*> InnerFields;
+	const_cast<FProperty*>(Property)->GetInnerFields(InnerFields);
+
+	for (const FField* InnerField : InnerFields)
+	{
+		if (const FProperty* InnerProperty = CastField<FProperty>(InnerField))
+		{
+			HashProperty(Builder, InnerProperty, OutDependencies);
+		}
+	}
+}
+
+void FCSGlueManifest::HashFunction(FXxHash64Builder& Builder, const UFunction* Function, TArray<const UObject*>& OutDependencies)
+{
+	HashName(Builder, Function->GetFName());
+	HashValue(Builder, Function->FunctionFlags);
+	HashValue(Builder, Function->NumParms);
+	HashMetaDataMap(Builder, UMetaData::GetMapForObject(Function));
+
+	for (TFieldIterator<FProperty> ParamIt(Function); ParamIt; ++ParamIt)
+	{
+		HashProperty(Builder, *ParamIt, OutDependencies);
+	}
+}
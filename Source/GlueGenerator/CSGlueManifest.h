@@ -0,0 +1,67 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Hash/xxhash.h"
+
+class FProperty;
+class UFunction;
+
+/**
+ * Persistent record of the reflection inputs each generated glue file was produced from.
+ * Lets the generator skip text generation and file reads for types that did not change since the last run.
+ */
+class FCSGlueManifest
+{
+public:
+
+	/** Loads the manifest stored in the given directory. Missing or malformed manifests start out empty. */
+	void Load(const FString& InDirectory);
+
+	/** Writes the manifest back to disk if any entry changed since it was loaded. */
+	void Save();
+
+	/** Whether glue was generated for this type in a previous run. */
+	bool HasEntry(const UObject* Object) const;
+
+	/** Whether the glue for this type was generated from the same inputs and the file is still on disk. */
+	bool IsUpToDate(const UObject* Object, uint64 TypeHash, const FString& GlueOutputPath) const;
+
+	/** Records the hash the glue for this type was just generated from. */
+	void UpdateEntry(const UObject* Object, uint64 TypeHash);
+
+	/** Hashes everything about a type that affects its generated glue: layout, flags, signatures, metadata, the types it embeds, the inclusion lists and generator version. */
+	uint64 ComputeTypeHash(const UObject* Object);
+
+	/** Folds the generator's allow and deny lists into every type hash, so changing them regenerates the glue. */
+	void SetInclusionListsHash(uint64 InInclusionListsHash);
+
+private:
+
+	/** Hash of a type on its own. The types it embeds are only referenced by path and listed as dependencies. */
+	struct FLocalTypeHash
+	{
+		uint64 Hash = 0;
+		TArray<const UObject*> Dependencies;
+	};
+
+	const FLocalTypeHash& ComputeLocalTypeHash(const UObject* Object);
+
+	static void HashStruct(FXxHash64Builder& Builder, const UStruct* Struct, TArray<const UObject*>& OutDependencies);
+	static void HashProperty(FXxHash64Builder& Builder, const FProperty* Property, TArray<const UObject*>& OutDependencies);
+	static void HashFunction(FXxHash64Builder& Builder, const UFunction* Function, TArray<const UObject*>& OutDependencies);
+
+	FString ManifestPath;
+	bool bDirty = false;
+
+	/** Type path name -> hash of the inputs its glue was generated from. */
+	TMap<FString, uint64> Entries;
+
+	/** Local hashes computed this session. */
+	TMap<const UObject*, FLocalTypeHash> LocalTypeHashes;
+
+	/** Full hashes computed this session. */
+	TMap<const UObject*, uint64> TypeHashCache;
+
+	uint64 InclusionListsHash = 0;
+
+};
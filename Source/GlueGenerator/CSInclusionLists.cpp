@@ -1,5 +1,6 @@
 ﻿#include "CSInclusionLists.h"
 #include "CSScriptBuilder.h"
+#include "Hash/xxhash.h"
 #include "Kismet/KismetMathLibrary.h"
 #include "UObject/UnrealType.h"
 
@@ -95,3 +96,55 @@ bool FCSInclusionLists::HasProperty(const UStruct* Struct, const FProperty* Prop
 	const TSet<FName>* List = Properties.Find(Struct->GetFName());
 	return List && List->Contains(Property->GetFName());
 }
+
+uint64 FCSInclusionLists::ComputeHash() const
+{
+	// Sets don't iterate in a stable order, so the entries are flattened to strings and sorted first.
+	TArray<FString> Entries;
+
+	auto AddNames = [&Entries](const TCHAR* Kind, const TSet<FName>& Names)
+	{
+		for (FName Name : Names)
+		{
+			Entries.Add(FString::Printf(TEXT("%s %s"), Kind, *Name.ToString()));
+		}
+	};
+
+	auto AddMemberNames = [&Entries](const TCHAR* Kind, const TMap<FName, TSet<FName>>& MemberNames)
+	{
+		for (const TPair<FName, TSet<FName>>& Struct : MemberNames)
+		{
+			for (FName Name : Struct.Value)
+			{
+				Entries.Add(FString::Printf(TEXT("%s %s.%s"), Kind, *Struct.Key.ToString(), *Name.ToString()));
+			}
+		}
+	};
+
+	AddNames(TEXT("Enum"), Enumerations);
+	AddNames(TEXT("Class"), Classes);
+	AddNames(TEXT("Struct"), Structs);
+	AddNames(TEXT("AllFunctions"), AllFunctions);
+	AddMemberNames(TEXT("Function"), Functions);
+	AddMemberNames(TEXT("OverridableFunction"), OverridableFunctions);
+	AddMemberNames(TEXT("Property"), Properties);
+
+	for (const TPair<FName, TSet<FString>>& Struct : FunctionCategories)
+	{
+		for (const FString& Category : Struct.Value)
+		{
+			Entries.Add(FString::Printf(TEXT("FunctionCategory %s.%s"), *Struct.Key.ToString(), *Category));
+		}
+	}
+
+	Entries.Sort();
+
+	FXxHash64Builder Builder;
+	for (const FString& Entry : Entries)
+	{
+		// Including the terminator keeps neighbouring entries from running into each other.
+		Builder.Update(*Entry, (Entry.Len() + 1) * sizeof(TCHAR));
+	}
+
+	return Builder.Finalize().Hash;
+}
@@ -21,6 +21,9 @@ public:
 	void AddProperty(FName StructName, FName PropertyName);
 	bool HasProperty(const UStruct* Struct, const FProperty* Property) const;
 
+	// Hash of every entry, the same no matter in which order they were added.
+	uint64 ComputeHash() const;
+
 private:
 	TSet<FName> Enumerations;
 	TSet<FName> Classes;
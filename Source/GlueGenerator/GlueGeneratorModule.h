@@ -5,9 +5,10 @@
 
 class FCSGenerator;
 
-#define GLUE_GENERATOR_VERSION 5
+#define GLUE_GENERATOR_VERSION 11
 #define GLUE_GENERATOR_CONFIG TEXT("GlueGeneratorSettings")
 #define GLUE_GENERATOR_VERSION_KEY TEXT("GlueGeneratorVersion")
+#define GLUE_GENERATOR_STRUCT_VIEWS_KEY TEXT("bGenerateStructViews")
 
 DECLARE_LOG_CATEGORY_EXTERN(LogGlueGenerator, Log, All);
 
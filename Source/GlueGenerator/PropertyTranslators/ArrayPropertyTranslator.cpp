@@ -57,7 +57,15 @@ void FArrayPropertyTranslator::ExportPropertyVariables(FCSScriptBuilder& Builder
 	}
 	else
 	{
-		Builder.AppendLine(FString::Printf(TEXT("%s %s_Marshaller = null;"), *GetWrapperType(Property), *NativePropertyName));
+		// The wrapper only points at native memory, so each object needs exactly one. The marshaller delegates are shared by all of them.
+		const FArrayProperty& ArrayProperty = *CastFieldChecked<FArrayProperty>(Property);
+		const FProperty* InnerProperty = ArrayProperty.Inner;
+		const FPropertyTranslator& Handler = PropertyHandlers.Find(InnerProperty);
+		const FString InnerType = Handler.GetManagedType(InnerProperty);
+		
+		Builder.AppendLine(FString::Printf(TEXT("static readonly (MarshallingDelegates<%s>.ToNative ToNative, MarshallingDelegates<%s>.FromNative FromNative) %s_Inner = (%s);"),
+			*InnerType, *InnerType, *NativePropertyName, *Handler.ExportMarshallerDelegates(InnerProperty, NativePropertyName)));
+		Builder.AppendLine(FString::Printf(TEXT("%s %s_Wrapper;"), *GetCachedWrapperType(Property), *NativePropertyName));
 	}
 }
 
@@ -77,14 +85,13 @@ void FArrayPropertyTranslator::ExportParameterVariables(FCSScriptBuilder& Builde
 
 void FArrayPropertyTranslator::ExportPropertyGetter(FCSScriptBuilder& Builder, const FProperty* Property, const FString& NativePropertyName) const
 {
-	const FArrayProperty& ArrayProperty = *CastFieldChecked<FArrayProperty>(Property);
-	const FProperty* InnerProperty = ArrayProperty.Inner;
-	const FPropertyTranslator& Handler = PropertyHandlers.Find(InnerProperty);
-
-	Builder.AppendLine(FString::Printf(TEXT("%s_Marshaller ??= new %s(1, %s_NativeProperty, %s);"), *NativePropertyName, *GetWrapperType(Property), *NativePropertyName, *Handler.ExportMarshallerDelegates(InnerProperty, NativePropertyName)));
-
-	Builder.AppendLine();
-	Builder.AppendLine(FString::Printf(TEXT("return %s_Marshaller.FromNative(IntPtr.Add(NativeObject,%s_Offset),0);"), *NativePropertyName, *NativePropertyName));
+	Builder.AppendLine(FString::Printf(TEXT("return %s_Wrapper ??= new %s(%s_NativeProperty, IntPtr.Add(NativeObject, %s_Offset), %s_Inner.ToNative, %s_Inner.FromNative);"),
+		*NativePropertyName,
+		*GetCachedWrapperType(Property),
+		*NativePropertyName,
+		*NativePropertyName,
+		*NativePropertyName,
+		*NativePropertyName));
 }
 
 void FArrayPropertyTranslator::ExportMarshalToNativeBuffer(FCSScriptBuilder& Builder, const FProperty* Property, const FString& NativePropertyName, const FString& DestinationBuffer, const FString& Offset, const
@@ -181,6 +188,15 @@ FString FArrayPropertyTranslator::GetWrapperType(const FProperty* Property) cons
 	return FString::Printf(TEXT("%s<%s>"), *UnrealArrayType, *Handler.GetManagedType(InnerProperty));
 }
 
+FString FArrayPropertyTranslator::GetCachedWrapperType(const FProperty* Property) const
+{
+	const FArrayProperty& ArrayProperty = *CastFieldChecked<FArrayProperty>(Property);
+	const FProperty* InnerProperty = ArrayProperty.Inner;
+	const FPropertyTranslator& Handler = PropertyHandlers.Find(InnerProperty);
+	
+	return FString::Printf(TEXT("UnrealSharp.%s<%s>"), Property->HasAnyPropertyFlags(CPF_BlueprintReadOnly) ? TEXT("ArrayReadOnly") : TEXT("Array"), *Handler.GetManagedType(InnerProperty));
+}
+
 FString FArrayPropertyTranslator::GetNullReturnCSharpValue(const FProperty* ReturnProperty) const
 {
 	return TEXT("null");
@@ -33,4 +33,7 @@ protected:
 
 	FString GetWrapperInterface(const FProperty* Property) const;
 	FString GetWrapperType(const FProperty* Property) const;
+
+	// The collection type cached on the owning object for class properties.
+	FString GetCachedWrapperType(const FProperty* Property) const;
 };
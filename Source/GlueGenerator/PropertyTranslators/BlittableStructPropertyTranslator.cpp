@@ -1,4 +1,5 @@
 #include "BlittableStructPropertyTranslator.h"
+#include "GlueGenerator/CSGenerator.h"
 
 FBlittableStructPropertyTranslator::FBlittableStructPropertyTranslator(FCSPropertyTranslatorManager& InPropertyHandlers)
 : FBlittableTypePropertyTranslator(InPropertyHandlers, FStructProperty::StaticClass(), "")
@@ -8,22 +9,100 @@ FBlittableStructPropertyTranslator::FBlittableStructPropertyTranslator(FCSProper
 
 bool FBlittableStructPropertyTranslator::IsStructBlittable(const FCSPropertyTranslatorManager& PropertyHandlers, const UScriptStruct& Struct)
 {
-	int32 CalculatedPropertySize = 0;
+	return AnalyzeStructLayout(PropertyHandlers, Struct).bIsBlittable;
+}
+
+FCSBlittableStructLayout FBlittableStructPropertyTranslator::AnalyzeStructLayout(const FCSPropertyTranslatorManager& PropertyHandlers, const UScriptStruct& Struct)
+{
+	FCSBlittableStructLayout Layout;
+	
+	TArray<const FProperty*> Members;
 	for (TFieldIterator<FProperty> PropIt(&Struct); PropIt; ++PropIt)
 	{
-		const FProperty* StructProperty = *PropIt;
+		Members.Add(*PropIt);
+	}
+
+	Members.StableSort([](const FProperty& A, const FProperty& B)
+	{
+		return A.GetOffset_ForInternal() < B.GetOffset_ForInternal();
+	});
+
+	// Structs that declare themselves POD can have unreflected members, we copy those along with the rest.
+	const bool bIsPlainOldData = Struct.StructFlags & STRUCT_IsPlainOldData;
+	const int32 StructureSize = Struct.GetStructureSize();
+	
+	int32 CoveredUntil = 0;
+	for (const FProperty* Member : Members)
+	{
+		const FPropertyTranslator& Translator = PropertyHandlers.Find(Member);
+		const FBoolProperty* BoolProperty = CastField<FBoolProperty>(Member);
+		const int32 Offset = Member->GetOffset_ForInternal();
+		const int32 MemberSize = Member->GetSize();
+
+		// Exported members get mirrored in C#, so they need to be exactly the type the managed side expects.
+		// Fixed arrays can't be mirrored, structs that export one stay marshalled so the array stays in their API.
+		const bool bIsMirrored = FCSGenerator::Get().CanExportProperty(Member->GetOwnerStruct(), Member);
 		
-		if (StructProperty->HasAnyPropertyFlags(CPF_BlueprintVisible) && PropertyHandlers.Find(StructProperty).IsBlittable())
+		if (bIsMirrored)
+		{
+			if (Member->ArrayDim != 1 || !Translator.IsBlittable())
+			{
+				return Layout;
+			}
+		}
+		else if (Translator.IsBlittable() || BoolProperty)
 		{
-			CalculatedPropertySize += StructProperty->ElementSize;
+			// Hidden members only need to survive a raw copy.
+			Layout.HiddenMembers.Add(Member->GetFName());
 		}
 		else
 		{
-			return false;
+			return Layout;
+		}
+
+		if (const FStructProperty* StructProperty = CastField<FStructProperty>(Member))
+		{
+			if (AnalyzeStructLayout(PropertyHandlers, *StructProperty->Struct).RequiresExtendedLayout())
+			{
+				Layout.ExtendedNestedStructs.AddUnique(StructProperty->Struct->GetFName());
+			}
 		}
+
+		if (Offset < CoveredUntil)
+		{
+			// Only bitfields share storage with the member before them.
+			if (!BoolProperty || BoolProperty->IsNativeBool())
+			{
+				return Layout;
+			}
+			
+			continue;
+		}
+
+		if (Offset != CoveredUntil && !bIsPlainOldData)
+		{
+			// Something unreflected may live in this gap, even if it's no bigger than alignment padding, and we can't tell if it's safe to copy.
+			return Layout;
+		}
+		
+		Layout.PaddingBytes += Offset - CoveredUntil;
+		CoveredUntil = Offset + MemberSize;
 	}
-	
-	return CalculatedPropertySize == Struct.GetStructureSize();
+
+	if (CoveredUntil > StructureSize)
+	{
+		return Layout;
+	}
+
+	// The same goes for the tail of the struct.
+	if (CoveredUntil != StructureSize && !bIsPlainOldData)
+	{
+		return Layout;
+	}
+
+	Layout.PaddingBytes += StructureSize - CoveredUntil;
+	Layout.bIsBlittable = true;
+	return Layout;
 }
 
 bool FBlittableStructPropertyTranslator::CanHandleProperty(const FProperty* Property) const
@@ -2,6 +2,24 @@
 
 #include "BlittableTypePropertyTranslator.h"
 
+// Result of laying out a struct's reflected members by offset to see if it can be copied with memcpy.
+struct FCSBlittableStructLayout
+{
+	bool bIsBlittable = false;
+
+	// Bytes not covered by any reflected member, alignment padding included.
+	int32 PaddingBytes = 0;
+
+	// Members that are copied as raw bytes but not mirrored in C#.
+	TArray<FName> HiddenMembers;
+
+	// Nested structs that are only blittable because of padding or hidden members.
+	TArray<FName> ExtendedNestedStructs;
+
+	// Whether the old rule (every member visible, no padding) would have rejected this struct.
+	bool RequiresExtendedLayout() const { return PaddingBytes > 0 || !HiddenMembers.IsEmpty() || !ExtendedNestedStructs.IsEmpty(); }
+};
+
 class FBlittableStructPropertyTranslator : public FBlittableTypePropertyTranslator
 {
 public:
@@ -9,6 +27,7 @@ public:
 	explicit FBlittableStructPropertyTranslator(FCSPropertyTranslatorManager& InPropertyHandlers);
 	
 	static bool IsStructBlittable(const FCSPropertyTranslatorManager& PropertyHandlers, const UScriptStruct& ScriptStruct);
+	static FCSBlittableStructLayout AnalyzeStructLayout(const FCSPropertyTranslatorManager& PropertyHandlers, const UScriptStruct& ScriptStruct);
 
 	//FPropertyTranslator interface implementation
 	virtual bool CanHandleProperty(const FProperty* Property) const override;
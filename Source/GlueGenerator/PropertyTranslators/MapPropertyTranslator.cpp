@@ -68,26 +68,18 @@ FString FMapPropertyTranslator::ExportMarshallerDelegates(const FProperty* Prope
 void FMapPropertyTranslator::ExportPropertyGetter(FCSScriptBuilder& Builder, const FProperty* Property, const FString& NativePropertyName) const
 {
 	const FMapProperty* MapProperty = CastFieldChecked<FMapProperty>(Property);
-	const FProperty* KeyProperty = MapProperty->KeyProp;
-	const FProperty* ValueProperty = MapProperty->ValueProp;
-	
-	const FPropertyTranslator& KeyHandler = PropertyHandlers.Find(KeyProperty);
-	const FPropertyTranslator& ValueHandler = PropertyHandlers.Find(ValueProperty);
+	const TCHAR* Name = *NativePropertyName;
 
-	FString Marshaller;
-	GetMarshaller(CastFieldChecked<FMapProperty>(Property), Marshaller);
-
-	Builder.AppendLine(FString::Printf(TEXT("%s_Marshaller ??= new %s(1, %s_NativeProperty, %s, %s);"),
-		*NativePropertyName,
-		*Marshaller,
-		*NativePropertyName,
-		*KeyHandler.ExportMarshallerDelegates(KeyProperty, NativePropertyName),
-		*ValueHandler.ExportMarshallerDelegates(ValueProperty, NativePropertyName)));
-
-	Builder.AppendLine();
-	Builder.AppendLine(FString::Printf(TEXT("return %s_Marshaller.FromNative(IntPtr.Add(NativeObject,%s_Offset),0);"),
-		*NativePropertyName,
-		*NativePropertyName));
+	if (MapProperty->HasAnyPropertyFlags(CPF_BlueprintReadOnly))
+	{
+		Builder.AppendLine(FString::Printf(TEXT("return %s_Wrapper ??= new %s(%s_NativeProperty, IntPtr.Add(NativeObject, %s_Offset), %s_Key.FromNative, %s_Value.FromNative);"),
+			Name, *GetCachedWrapperType(MapProperty), Name, Name, Name, Name));
+	}
+	else
+	{
+		Builder.AppendLine(FString::Printf(TEXT("return %s_Wrapper ??= new %s(%s_NativeProperty, IntPtr.Add(NativeObject, %s_Offset), %s_Key.FromNative, %s_Key.ToNative, %s_Value.FromNative, %s_Value.ToNative);"),
+			Name, *GetCachedWrapperType(MapProperty), Name, Name, Name, Name, Name, Name));
+	}
 }
 
 void FMapPropertyTranslator::ExportMarshalToNativeBuffer(FCSScriptBuilder& Builder, const FProperty* Property,
@@ -206,10 +198,34 @@ void FMapPropertyTranslator::ExportPropertyVariables(FCSScriptBuilder& Builder,
 	}
 	else
 	{
-		Builder.AppendLine(FString::Printf(TEXT("%s %s_Marshaller = null;"), *Marshaller, *PropertyName));
+		// The wrapper only points at native memory, so each object needs exactly one. The marshaller delegates are shared by all of them.
+		const FMapProperty* MapProperty = CastFieldChecked<FMapProperty>(Property);
+		ExportDelegateField(Builder, MapProperty->KeyProp, PropertyName, TEXT("Key"));
+		ExportDelegateField(Builder, MapProperty->ValueProp, PropertyName, TEXT("Value"));
+		Builder.AppendLine(FString::Printf(TEXT("%s %s_Wrapper;"), *GetCachedWrapperType(MapProperty), *PropertyName));
 	}
 }
 
+void FMapPropertyTranslator::ExportDelegateField(FCSScriptBuilder& Builder, const FProperty* InnerProperty, const FString& PropertyName, const TCHAR* Suffix) const
+{
+	const FPropertyTranslator& Handler = PropertyHandlers.Find(InnerProperty);
+	const FString InnerType = Handler.GetManagedType(InnerProperty);
+	
+	Builder.AppendLine(FString::Printf(TEXT("static readonly (MarshallingDelegates<%s>.ToNative ToNative, MarshallingDelegates<%s>.FromNative FromNative) %s_%s = (%s);"),
+		*InnerType, *InnerType, *PropertyName, Suffix, *Handler.ExportMarshallerDelegates(InnerProperty, PropertyName)));
+}
+
+FString FMapPropertyTranslator::GetCachedWrapperType(const FMapProperty* Property) const
+{
+	const FPropertyTranslator& KeyHandler = PropertyHandlers.Find(Property->KeyProp);
+	const FPropertyTranslator& ValueHandler = PropertyHandlers.Find(Property->ValueProp);
+	
+	return FString::Printf(TEXT("UnrealSharp.%s<%s, %s>"),
+		Property->HasAnyPropertyFlags(CPF_BlueprintReadOnly) ? TEXT("MapReadOnly") : TEXT("Map"),
+		*KeyHandler.GetManagedType(Property->KeyProp),
+		*ValueHandler.GetManagedType(Property->ValueProp));
+}
+
 FString FMapPropertyTranslator::GetNullReturnCSharpValue(const FProperty* ReturnProperty) const
 {
 	return TEXT("null");
@@ -35,5 +35,9 @@ protected:
 private:
 
 	void GetMarshaller(const FMapProperty* Property, FString& Marshaller) const;
+
+	// The dictionary type cached on the owning object for class properties, and the shared marshaller delegates it's built with.
+	FString GetCachedWrapperType(const FMapProperty* Property) const;
+	void ExportDelegateField(FCSScriptBuilder& Builder, const FProperty* InnerProperty, const FString& PropertyName, const TCHAR* Suffix) const;
 	
 };
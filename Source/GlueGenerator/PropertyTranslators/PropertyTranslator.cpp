@@ -148,7 +148,7 @@ void FPropertyTranslator::ExportWrapperProperty(FCSScriptBuilder& Builder, const
 
 	ExportReferences(Property);
 	ExportDelegateReferences(Property);
-	OnPropertyExported(Builder, Property, NativePropertyName);
+	OnPropertyExported(Builder, Property, NativePropertyName, CSharpPropertyName);
 	Builder.AppendLine();
 
 	if (Property->HasAnyPropertyFlags(CPF_EditorOnly))
@@ -193,6 +193,13 @@ void FPropertyTranslator::ExportMirrorProperty(FCSScriptBuilder& Builder, const
 	GetPropertyProtection(Property, Protection);
 
 	AppendTooltip(Property, Builder);
+
+	if (bSuppressOffsets)
+	{
+		// Blittable structs use an explicit layout that matches the native one.
+		Builder.AppendLine(FString::Printf(TEXT("[FieldOffset(%d)]"), Property->GetOffset_ForInternal()));
+	}
+	
 	Builder.AppendLine(FString::Printf(TEXT("%s%s %s;"), GetData(Protection), *GetManagedType(Property), *CSharpPropertyName));
 
 	ExportReferences(Property);
@@ -984,6 +991,89 @@ void FPropertyTranslator::ExportDelegateFunction(FCSScriptBuilder& Builder, UFun
 	Exporter.ExportInvoke(Builder, FunctionExporter::InvokeMode::Normal);
 	Builder.EndUnsafeBlock();
 	Builder.CloseBrace();
+
+	if (SignatureFunction->HasAnyFunctionFlags(FUNC_MulticastDelegate))
+	{
+		Builder.AppendLine();
+		ExportDelegateManagedHandlerInvoker(Builder, SignatureFunction);
+	}
+}
+
+void FPropertyTranslator::ExportDelegateManagedHandlerInvoker(FCSScriptBuilder& Builder, UFunction* SignatureFunction) const
+{
+	// Reads the broadcast's parameter buffer and calls a managed handler bound through a native delegate target.
+	const FString NativeMethodName = SignatureFunction->GetName();
+	
+	Builder.AppendLine(TEXT("protected override void InvokeManagedHandler(Signature handler, IntPtr buffer)"));
+	Builder.OpenBrace();
+	Builder.BeginUnsafeBlock();
+
+	FString ParamsCallString;
+	for (TFieldIterator<FProperty> ParamIt(SignatureFunction); ParamIt; ++ParamIt)
+	{
+		FProperty* ParamProperty = *ParamIt;
+		const FPropertyTranslator& ParamHandler = PropertyHandlers.Find(ParamProperty);
+		FString NativeParamName = ParamProperty->GetName();
+		FString CSharpParamName = GetScriptNameMapper().MapParameterName(ParamProperty);
+		FString ParamType = ParamHandler.GetManagedType(ParamProperty);
+
+		FString RefQualifier;
+		if (!ParamProperty->HasAnyPropertyFlags(CPF_ConstParm))
+		{
+			if (ParamProperty->HasAnyPropertyFlags(CPF_ReferenceParm))
+			{
+				RefQualifier = TEXT("ref ");
+			}
+			else if (ParamProperty->HasAnyPropertyFlags(CPF_OutParm))
+			{
+				RefQualifier = TEXT("out ");
+			}
+		}
+
+		if (RefQualifier == TEXT("out "))
+		{
+			Builder.AppendLine(FString::Printf(TEXT("%s %s = default;"), *ParamType, *CSharpParamName));
+		}
+		else
+		{
+			ParamHandler.ExportMarshalFromNativeBuffer(
+				Builder,
+				ParamProperty, 
+				NativeParamName,
+				FString::Printf(TEXT("%s %s ="), *ParamType, *CSharpParamName),
+				"buffer",
+				FString::Printf(TEXT("%s_%s_Offset"), *NativeMethodName, *NativeParamName),
+				false,
+				false);
+		}
+
+		ParamsCallString += FString::Printf(TEXT("%s%s, "), *RefQualifier, *CSharpParamName);
+	}
+
+	ParamsCallString.RemoveFromEnd(TEXT(", "));
+	Builder.AppendLine(FString::Printf(TEXT("handler(%s);"), *ParamsCallString));
+
+	for (TFieldIterator<FProperty> ParamIt(SignatureFunction); ParamIt; ++ParamIt)
+	{
+		FProperty* ParamProperty = *ParamIt;
+		if (ParamProperty->HasAnyPropertyFlags(CPF_ConstParm) || !ParamProperty->HasAnyPropertyFlags(CPF_OutParm))
+		{
+			continue;
+		}
+
+		const FPropertyTranslator& ParamHandler = PropertyHandlers.Find(ParamProperty);
+		FString NativePropertyName = ParamProperty->GetName();
+		ParamHandler.ExportMarshalToNativeBuffer(
+			Builder,
+			ParamProperty, 
+			NativePropertyName,
+			"buffer",
+			FString::Printf(TEXT("%s_%s_Offset"), *NativeMethodName, *NativePropertyName),
+			GetScriptNameMapper().MapParameterName(ParamProperty));
+	}
+
+	Builder.EndUnsafeBlock();
+	Builder.CloseBrace();
 }
 
 void FPropertyTranslator::MakeNativePropertyField(FCSScriptBuilder& Builder, const FString& PropertyName) const
@@ -1038,7 +1128,7 @@ void FPropertyTranslator::ExportPropertyGetter(FCSScriptBuilder& Builder, const
 		false);
 }
 
-void FPropertyTranslator::OnPropertyExported(FCSScriptBuilder& Builder, const FProperty* Property, const FString& PropertyName) const
+void FPropertyTranslator::OnPropertyExported(FCSScriptBuilder& Builder, const FProperty* Property, const FString& NativePropertyName, const FString& CSharpPropertyName) const
 {
 	
 }
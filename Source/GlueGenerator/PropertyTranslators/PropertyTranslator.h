@@ -78,6 +78,7 @@ public:
 	void ExportInterfaceFunction(FCSScriptBuilder& Builder, UFunction* Function) const;
 	void ExportOverridableFunction(FCSScriptBuilder& Builder, UFunction* Function) const;
 	void ExportDelegateFunction(FCSScriptBuilder& Builder, UFunction* SignatureFunction) const;
+	void ExportDelegateManagedHandlerInvoker(FCSScriptBuilder& Builder, UFunction* SignatureFunction) const;
 
 	void MakeNativePropertyField(FCSScriptBuilder& Builder, const FString& PropertyName) const;
 	void MakeGetNativePropertyFromName(FCSScriptBuilder& Builder, const FString& PropertyName) const;
@@ -91,7 +92,8 @@ public:
 
 	// Subclasses must override to export the C# property's get accessor, if property usage is supported.
 	virtual void ExportPropertyGetter(FCSScriptBuilder& Builder, const FProperty* Property, const FString& PropertyName) const;
-	virtual void OnPropertyExported(FCSScriptBuilder& Builder, const FProperty* Property, const FString& PropertyName) const;
+	// Called after a class property's wrapper is exported, with the native name used for its fields and the name of the C# property.
+	virtual void OnPropertyExported(FCSScriptBuilder& Builder, const FProperty* Property, const FString& NativePropertyName, const FString& CSharpPropertyName) const;
 	
 	struct FunctionOverload
 	{
@@ -1,4 +1,6 @@
 #include "StructPropertyTranslator.h"
+#include "GlueGenerator/CSGenerator.h"
+#include "GlueGenerator/CSScriptBuilder.h"
 
 FStructPropertyTranslator::FStructPropertyTranslator(FCSPropertyTranslatorManager& InPropertyHandlers)
 : FSimpleTypePropertyTranslator(InPropertyHandlers, FStructProperty::StaticClass(), EPU_Any)
@@ -19,6 +21,37 @@ void FStructPropertyTranslator::AddReferences(const FProperty* Property, TSet<UF
 	References.Add(StructProperty->Struct);
 }
 
+void FStructPropertyTranslator::OnPropertyExported(FCSScriptBuilder& Builder, const FProperty* Property, const FString& NativePropertyName, const FString& CSharpPropertyName) const
+{
+	if (Property->ArrayDim != 1 || !Property->GetOwner<UClass>())
+	{
+		return;
+	}
+
+	const FStructProperty* StructProperty = CastFieldChecked<FStructProperty>(Property);
+	if (!FCSGenerator::Get().ShouldExportStructView(StructProperty->Struct))
+	{
+		return;
+	}
+
+	// Alongside the copying property, expose a view for callers that only need a few fields.
+	const FString StructName = GetScriptNameMapper().GetStructScriptName(StructProperty->Struct);
+	
+	FString Protection;
+	GetClassPropertyProtection(Property, Protection);
+	
+	Builder.AppendLine();
+	Builder.AppendLine(FString::Printf(TEXT("// Reads %s in place. Fields are marshalled when accessed instead of copying the whole struct."), *CSharpPropertyName));
+	Builder.AppendLine(FString::Printf(TEXT("%s%s.%sView %sView"), *Protection, *GetManagedType(Property), *StructName, *CSharpPropertyName));
+	Builder.OpenBrace();
+	Builder.AppendLine(TEXT("get"));
+	Builder.OpenBrace();
+	AddCheckObjectForValidity(Builder);
+	Builder.AppendLine(FString::Printf(TEXT("return new %s.%sView(IntPtr.Add(NativeObject, %s_Offset));"), *GetManagedType(Property), *StructName, *NativePropertyName));
+	Builder.CloseBrace();
+	Builder.CloseBrace();
+}
+
 FString FStructPropertyTranslator::GetMarshaller(const FProperty *Property) const
 {
 	return FString::Printf(TEXT("%sMarshaller"), *GetManagedType(Property));
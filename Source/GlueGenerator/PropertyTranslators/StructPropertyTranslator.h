@@ -11,6 +11,7 @@ public:
 	//FPropertyTranslator interface implementation
 	virtual FString GetManagedType(const FProperty* Property) const override;
 	virtual void AddReferences(const FProperty* Property, TSet<UField*>& References) const override;
+	virtual void OnPropertyExported(FCSScriptBuilder& Builder, const FProperty* Property, const FString& NativePropertyName, const FString& CSharpPropertyName) const override;
 protected:
 	virtual FString GetMarshaller(const FProperty *Property) const;
 	virtual bool CanExportDefaultParameter() const override { return false; }
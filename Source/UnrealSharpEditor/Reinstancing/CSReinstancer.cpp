@@ -79,6 +79,12 @@ bool FCSReinstancer::TryUpdatePin(FEdGraphPinType& PinType)
 
 void FCSReinstancer::StartReinstancing()
 {
+	// Every reloaded type kept its layout and was rebound in place, there's nothing to patch up.
+	if (ClassesToReinstance.IsEmpty() && StructsToReinstance.IsEmpty() && InterfacesToReinstance.IsEmpty())
+	{
+		return;
+	}
+
 	TUniquePtr<FReload> Reload = MakeUnique<FReload>(EActiveReloadType::Reinstancing, TEXT(""), *GWarn);
 	Reload->SetSendReloadCompleteNotification(false);
 
@@ -6,9 +6,13 @@
 #include "CSharpForUE/CSManager.h"
 #include "CSharpForUE/CSDeveloperSettings.h"
 #include "Misc/ScopedSlowTask.h"
+#include "Misc/MessageDialog.h"
+#include "Async/Async.h"
 #include "Reinstancing/CSReinstancer.h"
 #include "UnrealSharpProcHelper/CSProcHelper.h"
+#include "UnrealSharpProcHelper/CSBuildServer.h"
 
+DEFINE_LOG_CATEGORY(LogUnrealSharpEditor);
 
 #define LOCTEXT_NAMESPACE "FUnrealSharpEditorModule"
 
@@ -37,10 +41,24 @@ void FUnrealSharpEditorModule::StartupModule()
 
 	TickDelegate = FTickerDelegate::CreateRaw(this, &FUnrealSharpEditorModule::Tick);
 	TickDelegateHandle = FTSTicker::GetCoreTicker().AddTicker(TickDelegate);
+
+	// Warm up the build server now, so the first hot reload doesn't wait for it.
+	if (GetDefault<UCSDeveloperSettings>()->bUseBuildServer)
+	{
+		FCSBuildServer::Get().Start();
+	}
 }
 
 void FUnrealSharpEditorModule::ShutdownModule()
 {
+	if (BuildTask.IsValid())
+	{
+		bCancelBuildRequested = true;
+		BuildTask.Wait();
+	}
+
+	FCSBuildServer::Get().Stop();
+	
 	FTSTicker::GetCoreTicker().RemoveTicker(TickDelegateHandle);
 	UToolMenus::UnRegisterStartupCallback(this);
 	UToolMenus::UnregisterOwner(this);
@@ -49,10 +67,6 @@ void FUnrealSharpEditorModule::ShutdownModule()
 
 void FUnrealSharpEditorModule::OnCSharpCodeModified(const TArray<FFileChangeData>& ChangedFiles)
 {
-	if (bIsReloading)
-	{
-		return;
-	}
 	const UCSDeveloperSettings* Settings = GetDefault<UCSDeveloperSettings>();
 
 	for (const FFileChangeData& ChangedFile : ChangedFiles)
@@ -69,6 +83,19 @@ void FUnrealSharpEditorModule::OnCSharpCodeModified(const TArray<FFileChangeData
 		{
 			continue;
 		}
+
+		// The running build is already stale, stop it and let Tick start a new one.
+		if (IsBuilding())
+		{
+			bCancelBuildRequested = true;
+			bIsReloading = true;
+			return;
+		}
+
+		if (bIsReloading)
+		{
+			return;
+		}
 		
 		// Return on the first .cs file we encounter so we can reload.
 		bIsReloading = true;
@@ -80,29 +107,87 @@ void FUnrealSharpEditorModule::OnCSharpCodeModified(const TArray<FFileChangeData
 		}
 		
 		StartHotReload();
-		bIsReloading = false;
 		return;
 	}
 }
 
 void FUnrealSharpEditorModule::StartHotReload()
 {
-	FScopedSlowTask Progress(4, LOCTEXT("ReloadingCSharp", "Building C# code..."));
-	Progress.MakeDialog();
-
-	// Build the user's project.
-	if (!FCSProcHelper::InvokeUnrealSharpBuildTool(Build))
+	if (IsBuilding())
 	{
 		return;
 	}
 
-	// Weave the user's project.
-	Progress.EnterProgressFrame(1, LOCTEXT("WeavingCSharp", "Weaving C# code..."));
-	if (!FCSProcHelper::InvokeUnrealSharpBuildTool(Weave))
+	bIsReloading = false;
+	bCancelBuildRequested = false;
+	BuildStartTime = FPlatformTime::Seconds();
+
+	FNotificationInfo Info(LOCTEXT("BuildingCSharp", "Building C# code..."));
+	Info.bFireAndForget = false;
+	Info.ExpireDuration = 0.0f;
+	BuildNotification = FSlateNotificationManager::Get().AddNotification(Info);
+	
+	if (BuildNotification.IsValid())
+	{
+		BuildNotification->SetCompletionState(SNotificationItem::CS_Pending);
+	}
+
+	// The server is stopped if it crashed or hung on a cancelled action, bring it back up for this build.
+	const bool bUseBuildServer = GetDefault<UCSDeveloperSettings>()->bUseBuildServer && FCSBuildServer::Get().Start();
+
+	// Build and weave the user's project without blocking the editor, the processes stream their output to the log.
+	BuildTask = Async(EAsyncExecution::Thread, [this, bUseBuildServer]
+	{
+		if (bUseBuildServer)
+		{
+			FCSBuildServer& BuildServer = FCSBuildServer::Get();
+			
+			FString Output;
+			const bool bSucceeded = BuildServer.RunAction(Build, Output, &bCancelBuildRequested)
+				&& BuildServer.RunAction(Weave, Output, &bCancelBuildRequested);
+
+			// Only fall back to a one-off build tool if the server itself went away.
+			if (bSucceeded || bCancelBuildRequested || BuildServer.IsRunning())
+			{
+				return bSucceeded;
+			}
+
+			UE_LOG(LogUnrealSharpEditor, Warning, TEXT("Build server stopped unexpectedly, building with a new build tool process instead."));
+		}
+		
+		return FCSProcHelper::InvokeUnrealSharpBuildTool(Build, nullptr, nullptr, &bCancelBuildRequested)
+			&& FCSProcHelper::InvokeUnrealSharpBuildTool(Weave, nullptr, nullptr, &bCancelBuildRequested);
+	});
+}
+
+void FUnrealSharpEditorModule::FinishHotReload(bool bBuildSucceeded)
+{
+	const double BuildTime = FPlatformTime::Seconds() - BuildStartTime;
+	
+	if (BuildNotification.IsValid())
+	{
+		BuildNotification->SetCompletionState(bBuildSucceeded ? SNotificationItem::CS_Success : SNotificationItem::CS_Fail);
+		BuildNotification->ExpireAndFadeout();
+		BuildNotification.Reset();
+	}
+
+	if (bCancelBuildRequested)
 	{
+		UE_LOG(LogUnrealSharpEditor, Display, TEXT("C# build cancelled after %.2f seconds, newer changes were detected."), BuildTime);
 		return;
 	}
 	
+	if (!bBuildSucceeded)
+	{
+		FMessageDialog::Open(EAppMsgType::Ok, LOCTEXT("BuildFailed", "C# build failed, see the Output Log for details."));
+		return;
+	}
+
+	UE_LOG(LogUnrealSharpEditor, Display, TEXT("C# build and weave took %.2f seconds."), BuildTime);
+	
+	FScopedSlowTask Progress(3, LOCTEXT("ReloadingCSharp", "Reloading C# code..."));
+	Progress.MakeDialog();
+	
 	// Unload the user's assembly, to apply the new one.
 	Progress.EnterProgressFrame(1, LOCTEXT("UnloadingAssembly", "Unloading Assembly..."));
 	if (!FCSManager::Get().UnloadAssembly(FCSProcHelper::GetUserManagedProjectName()))
@@ -124,15 +209,25 @@ void FUnrealSharpEditorModule::StartHotReload()
 
 bool FUnrealSharpEditorModule::Tick(float DeltaTime)
 {
+	if (BuildTask.IsValid() && BuildTask.IsReady())
+	{
+		const bool bBuildSucceeded = BuildTask.Get();
+		BuildTask.Reset();
+		FinishHotReload(bBuildSucceeded);
+	}
+
+	if (!bIsReloading || IsBuilding())
+	{
+		return true;
+	}
 
 	const UCSDeveloperSettings* Settings = GetDefault<UCSDeveloperSettings>();
-	if (!Settings->bRequireFocusForHotReload || !bIsReloading || !FApp::HasFocus())
+	if (Settings->bRequireFocusForHotReload && !FApp::HasFocus())
 	{
 		return true;
 	}
 
 	StartHotReload();
-	bIsReloading = false;
 	return true;
 }
 
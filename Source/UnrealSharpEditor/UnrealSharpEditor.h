@@ -3,6 +3,10 @@
 #include "CoreMinimal.h"
 #include "Modules/ModuleManager.h"
 #include "Containers/Ticker.h"
+#include "Async/Future.h"
+#include "HAL/ThreadSafeBool.h"
+
+DECLARE_LOG_CATEGORY_EXTERN(LogUnrealSharpEditor, Log, All);
 
 class FUnrealSharpEditorModule : public IModuleInterface
 {
@@ -17,14 +21,24 @@ public:
     void StartHotReload();
 
     bool IsReloading() const { return bIsReloading; }
+    bool IsBuilding() const { return BuildTask.IsValid(); }
 
 private:
     
     bool Tick(float DeltaTime);
+
+    // Runs on the game thread once the background build and weave has finished.
+    void FinishHotReload(bool bBuildSucceeded);
     
     FTickerDelegate TickDelegate;
     FTSTicker::FDelegateHandle TickDelegateHandle;
     bool bIsReloading = false;
 
+    // Build and weave of the user's project, running off the game thread.
+    TFuture<bool> BuildTask;
+    FThreadSafeBool bCancelBuildRequested;
+    double BuildStartTime = 0.0;
+    TSharedPtr<class SNotificationItem> BuildNotification;
+
     void RegisterMenus();
 };
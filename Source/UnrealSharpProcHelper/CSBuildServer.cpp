@@ -0,0 +1,258 @@
+#include "CSBuildServer.h"
+#include "UnrealSharpProcHelper.h"
+#include "Misc/Paths.h"
+
+// Must match UnrealSharpBuildTool.Actions.BuildServer.
+static const TCHAR* BuildServerReadyMessage = TEXT("UnrealSharpBuildServer:Ready");
+static const TCHAR* BuildServerActionCompletedPrefix = TEXT("UnrealSharpBuildServer:Completed");
+static const TCHAR* BuildServerExitCommand = TEXT("Exit");
+static const TCHAR* BuildServerCancelCommand = TEXT("Cancel");
+
+// How long to sleep between polls of the server when it has no new output.
+static constexpr float BuildServerPollInterval = 0.02f;
+
+// How long the server gets to exit on its own before it is terminated.
+static constexpr double BuildServerExitTimeout = 2.0;
+
+// How long the server gets to start up, a cold dotnet start with JIT can take a few seconds.
+static constexpr double BuildServerStartTimeout = 30.0;
+
+// How long a cancelled action gets to wind down. Builds stop right away, a weave runs to the end.
+static constexpr double BuildServerCancelTimeout = 10.0;
+
+FCSBuildServer::~FCSBuildServer()
+{
+	Stop();
+}
+
+bool FCSBuildServer::Start()
+{
+	if (IsRunning())
+	{
+		return true;
+	}
+
+	const FString DotNetPath = FCSProcHelper::GetDotNetExecutablePath();
+
+	if (!FPaths::FileExists(DotNetPath) || !FPaths::FileExists(FCSProcHelper::GetUnrealSharpBuildToolPath()))
+	{
+		UE_LOG(LogUnrealSharpProcHelper, Warning, TEXT("Can't start the build server, dotnet or UnrealSharpBuildTool is missing."));
+		return false;
+	}
+
+	FPlatformProcess::CreatePipe(StdOutReadPipe, StdOutWritePipe);
+
+	// The write end of stdin stays on our side.
+	FPlatformProcess::CreatePipe(StdInReadPipe, StdInWritePipe, true);
+
+	const FString Arguments = FCSProcHelper::GetUnrealSharpBuildToolArguments(BuildServer);
+	const FString WorkingDirectory = FCSProcHelper::GetAssembliesPath();
+
+	ProcHandle = FPlatformProcess::CreateProc(*DotNetPath,
+	                                          *Arguments,
+	                                          false,
+	                                          true,
+	                                          true,
+	                                          nullptr, 0,
+	                                          *WorkingDirectory,
+	                                          StdOutWritePipe,
+	                                          StdInReadPipe);
+
+	if (!ProcHandle.IsValid())
+	{
+		UE_LOG(LogUnrealSharpProcHelper, Warning, TEXT("Failed to launch the build server, falling back to a new build tool process per action."));
+		Stop();
+		return false;
+	}
+
+	UE_LOG(LogUnrealSharpProcHelper, Display, TEXT("Started the UnrealSharp build server."));
+	return true;
+}
+
+void FCSBuildServer::Stop()
+{
+	if (ProcHandle.IsValid())
+	{
+		if (FPlatformProcess::IsProcRunning(ProcHandle))
+		{
+			FPlatformProcess::WritePipe(StdInWritePipe, BuildServerExitCommand);
+
+			const double ExitDeadline = FPlatformTime::Seconds() + BuildServerExitTimeout;
+			while (FPlatformProcess::IsProcRunning(ProcHandle) && FPlatformTime::Seconds() < ExitDeadline)
+			{
+				FPlatformProcess::Sleep(BuildServerPollInterval);
+			}
+
+			if (FPlatformProcess::IsProcRunning(ProcHandle))
+			{
+				FPlatformProcess::TerminateProc(ProcHandle, true);
+			}
+		}
+
+		FPlatformProcess::CloseProc(ProcHandle);
+		ProcHandle.Reset();
+	}
+
+	if (StdOutReadPipe || StdOutWritePipe)
+	{
+		FPlatformProcess::ClosePipe(StdOutReadPipe, StdOutWritePipe);
+		StdOutReadPipe = StdOutWritePipe = nullptr;
+	}
+
+	if (StdInReadPipe || StdInWritePipe)
+	{
+		FPlatformProcess::ClosePipe(StdInReadPipe, StdInWritePipe);
+		StdInReadPipe = StdInWritePipe = nullptr;
+	}
+
+	PendingOutput.Reset();
+	bReady = false;
+}
+
+bool FCSBuildServer::IsRunning() const
+{
+	return ProcHandle.IsValid() && FPlatformProcess::IsProcRunning(const_cast<FProcHandle&>(ProcHandle));
+}
+
+bool FCSBuildServer::RunAction(EBuildAction BuildAction, FString& Output, const FThreadSafeBool* bCancelRequested)
+{
+	if (!IsRunning())
+	{
+		return false;
+	}
+
+	// Waited for here rather than in Start, which runs on the game thread.
+	if (!bReady && !WaitForReady())
+	{
+		UE_LOG(LogUnrealSharpProcHelper, Warning, TEXT("The build server didn't start."));
+		Stop();
+		return false;
+	}
+
+	const FString ActionName = StaticEnum<EBuildAction>()->GetNameStringByValue(BuildAction);
+	const double StartTime = FPlatformTime::Seconds();
+
+	if (!FPlatformProcess::WritePipe(StdInWritePipe, ActionName))
+	{
+		UE_LOG(LogUnrealSharpProcHelper, Warning, TEXT("Failed to send %s to the build server."), *ActionName);
+		Stop();
+		return false;
+	}
+
+	FString Line;
+	bool bCancelSent = false;
+	double CancelDeadline = 0.0;
+	
+	while (true)
+	{
+		if (!ReadLine(Line, bCancelSent ? nullptr : bCancelRequested, CancelDeadline))
+		{
+			// Abort only the action in flight and wait for it to complete, so the server stays up for the next build.
+			const bool bCancelled = !bCancelSent && bCancelRequested && *bCancelRequested;
+			if (bCancelled && IsRunning() && FPlatformProcess::WritePipe(StdInWritePipe, BuildServerCancelCommand))
+			{
+				bCancelSent = true;
+				CancelDeadline = FPlatformTime::Seconds() + BuildServerCancelTimeout;
+				continue;
+			}
+			
+			break;
+		}
+		
+		if (!Line.StartsWith(BuildServerActionCompletedPrefix))
+		{
+			UE_LOG(LogUnrealSharpProcHelper, Log, TEXT("[BuildServer] %s"), *Line);
+			Output += Line + LINE_TERMINATOR;
+			continue;
+		}
+
+		// "<Prefix> <ExitCode> <ElapsedMilliseconds>"
+		TArray<FString> Tokens;
+		Line.ParseIntoArrayWS(Tokens);
+
+		const int32 ExitCode = Tokens.IsValidIndex(1) ? FCString::Atoi(*Tokens[1]) : 1;
+		const int64 ServerMilliseconds = Tokens.IsValidIndex(2) ? FCString::Atoi64(*Tokens[2]) : 0;
+		const double ElapsedTime = FPlatformTime::Seconds() - StartTime;
+
+		if (bCancelSent)
+		{
+			UE_LOG(LogUnrealSharpProcHelper, Display, TEXT("Build server %s was cancelled after %f seconds."), *ActionName, ElapsedTime);
+			return false;
+		}
+
+		if (ExitCode != 0)
+		{
+			UE_LOG(LogUnrealSharpProcHelper, Error, TEXT("Build server %s failed after %f seconds. Error: %s"), *ActionName, ElapsedTime, *Output);
+			return false;
+		}
+
+		UE_LOG(LogUnrealSharpProcHelper, Display, TEXT("Build server %s took %f seconds (%lld ms in the server)."), *ActionName, ElapsedTime, ServerMilliseconds);
+		return true;
+	}
+
+	// The server went away, or didn't finish a cancelled action in time. Its output would no longer line up with our actions,
+	// so it's stopped and started again on the next hot reload.
+	UE_LOG(LogUnrealSharpProcHelper, Display, TEXT("Build server %s was interrupted after %f seconds."), *ActionName, FPlatformTime::Seconds() - StartTime);
+	Stop();
+	return false;
+}
+
+bool FCSBuildServer::WaitForReady()
+{
+	const double Deadline = FPlatformTime::Seconds() + BuildServerStartTimeout;
+
+	FString Line;
+	while (ReadLine(Line, nullptr, Deadline))
+	{
+		if (Line == BuildServerReadyMessage)
+		{
+			bReady = true;
+			return true;
+		}
+
+		UE_LOG(LogUnrealSharpProcHelper, Log, TEXT("[BuildServer] %s"), *Line);
+	}
+
+	return false;
+}
+
+bool FCSBuildServer::ReadLine(FString& OutLine, const FThreadSafeBool* bCancelRequested, double Deadline)
+{
+	while (true)
+	{
+		int32 NewLineIndex;
+		if (PendingOutput.FindChar(TEXT('\n'), NewLineIndex))
+		{
+			OutLine = PendingOutput.Left(NewLineIndex);
+			OutLine.TrimEndInline();
+			PendingOutput.RightChopInline(NewLineIndex + 1);
+			return true;
+		}
+
+		if (bCancelRequested && *bCancelRequested)
+		{
+			return false;
+		}
+
+		if (Deadline > 0.0 && FPlatformTime::Seconds() > Deadline)
+		{
+			return false;
+		}
+
+		const bool bIsRunning = IsRunning();
+
+		FString NewOutput = FPlatformProcess::ReadPipe(StdOutReadPipe);
+		if (!NewOutput.IsEmpty())
+		{
+			PendingOutput += NewOutput;
+			continue;
+		}
+
+		if (!bIsRunning)
+		{
+			return false;
+		}
+
+		FPlatformProcess::Sleep(BuildServerPollInterval);
+	}
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+#include "CSProcHelper.h"
+#include "HAL/ThreadSafeBool.h"
+
+// Long-lived UnrealSharpBuildTool process that hot reload sends Build/Weave actions to over its stdin,
+// so MSBuild, the weaver and the bindings assembly don't need to cold start for every change.
+// Only used from one thread at a time: started/stopped on the game thread, actions run on the hot reload worker.
+class UNREALSHARPPROCHELPER_API FCSBuildServer final
+{
+public:
+
+	static FCSBuildServer& Get()
+	{
+		static FCSBuildServer Instance;
+		return Instance;
+	}
+
+	~FCSBuildServer();
+
+	bool Start();
+	void Stop();
+
+	bool IsRunning() const;
+
+	// Runs an action in the server, streaming its output to the log.
+	// Returns false if the action failed or was cancelled. A cancel only aborts the action, the server keeps running.
+	// If the server died or didn't wind down a cancelled action in time it is stopped, and IsRunning returns false.
+	bool RunAction(EBuildAction BuildAction, FString& Output, const FThreadSafeBool* bCancelRequested = nullptr);
+
+private:
+
+	// Reads the next full line of output. Fails if cancelled, if the server exits or, with a deadline, once FPlatformTime::Seconds() passes it.
+	bool ReadLine(FString& OutLine, const FThreadSafeBool* bCancelRequested, double Deadline = 0.0);
+
+	// Waits for the server to announce it reads commands, so nothing is sent before it's listening. Output before that is logged.
+	bool WaitForReady();
+
+	FProcHandle ProcHandle;
+
+	void* StdOutReadPipe = nullptr;
+	void* StdOutWritePipe = nullptr;
+	void* StdInReadPipe = nullptr;
+	void* StdInWritePipe = nullptr;
+
+	// Output read from the server that doesn't form a full line yet.
+	FString PendingOutput;
+
+	// Whether the server printed its ready line since it was started.
+	bool bReady = false;
+
+};
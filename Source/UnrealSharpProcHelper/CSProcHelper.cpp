@@ -5,7 +5,37 @@
 #include "Interfaces/IPluginManager.h"
 #include "Misc/MessageDialog.h"
 
-bool FCSProcHelper::InvokeCommand(const FString& ProgramPath, const FString& Arguments, int32& OutReturnCode, FString& Output, FString* InWorkingDirectory)
+// How long to sleep between polls of a child process that has no new output.
+static constexpr float ProcPollInterval = 0.02f;
+
+static void LogProcOutputLines(const FString& ProgramName, FString& PendingLine, const FString& NewOutput)
+{
+	PendingLine += NewOutput;
+
+	int32 NewLineIndex;
+	while (PendingLine.FindChar(TEXT('\n'), NewLineIndex))
+	{
+		FString Line = PendingLine.Left(NewLineIndex);
+		Line.TrimEndInline();
+		PendingLine.RightChopInline(NewLineIndex + 1);
+
+		if (!Line.IsEmpty())
+		{
+			UE_LOG(LogUnrealSharpProcHelper, Log, TEXT("[%s] %s"), *ProgramName, *Line);
+		}
+	}
+}
+
+static void ShowProcErrorDialog(const FString& DialogText)
+{
+	// Commands can run on a worker thread during hot reload, the caller reports the failure there.
+	if (IsInGameThread())
+	{
+		FMessageDialog::Open(EAppMsgType::Ok, FText::FromString(DialogText));
+	}
+}
+
+bool FCSProcHelper::InvokeCommand(const FString& ProgramPath, const FString& Arguments, int32& OutReturnCode, FString& Output, FString* InWorkingDirectory, const FThreadSafeBool* bCancelRequested)
 {
 	double StartTime = FPlatformTime::Seconds();
 	FString ProgramName = FPaths::GetBaseFilename(ProgramPath);
@@ -15,7 +45,7 @@ bool FCSProcHelper::InvokeCommand(const FString& ProgramPath, const FString& Arg
 		FString DialogText = FString::Printf(TEXT("Failed to find %s at %s"), *ProgramName, *ProgramPath);
 		UE_LOG(LogUnrealSharpProcHelper, Error, TEXT("%s"), *DialogText);
 		
-		FMessageDialog::Open(EAppMsgType::Ok, FText::FromString(DialogText));
+		ShowProcErrorDialog(DialogText);
 		return false;
 	}
 		
@@ -44,36 +74,87 @@ bool FCSProcHelper::InvokeCommand(const FString& ProgramPath, const FString& Arg
 		FString DialogText = FString::Printf(TEXT("%s failed to launch!"), *ProgramName);
 		UE_LOG(LogUnrealSharpProcHelper, Error, TEXT("%s"), *DialogText);
 		
-		FMessageDialog::Open(EAppMsgType::Ok, FText::FromString(DialogText));
+		FPlatformProcess::ClosePipe(ReadPipe, WritePipe);
+		ShowProcErrorDialog(DialogText);
 		return false;
 	}
+
+	FString PendingLine;
+	bool bCancelled = false;
 	
-	while (FPlatformProcess::IsProcRunning(ProcHandle))
+	while (true)
 	{
-		Output += FPlatformProcess::ReadPipe(ReadPipe);
+		if (bCancelRequested && *bCancelRequested)
+		{
+			FPlatformProcess::TerminateProc(ProcHandle, true);
+			bCancelled = true;
+			break;
+		}
+		
+		// Check before reading, so output written right before the process exits is still drained.
+		const bool bIsRunning = FPlatformProcess::IsProcRunning(ProcHandle);
+		
+		FString NewOutput = FPlatformProcess::ReadPipe(ReadPipe);
+		if (!NewOutput.IsEmpty())
+		{
+			Output += NewOutput;
+			LogProcOutputLines(ProgramName, PendingLine, NewOutput);
+			continue;
+		}
+
+		if (!bIsRunning)
+		{
+			break;
+		}
+
+		// Nothing to read yet, don't compete with the process for CPU.
+		FPlatformProcess::Sleep(ProcPollInterval);
+	}
+
+	LogProcOutputLines(ProgramName, PendingLine, TEXT("\n"));
+
+	if (bCancelled)
+	{
+		OutReturnCode = INDEX_NONE;
+	}
+	else
+	{
+		FPlatformProcess::GetProcReturnCode(ProcHandle, &OutReturnCode);
 	}
 	
-	FPlatformProcess::GetProcReturnCode(ProcHandle, &OutReturnCode);
 	FPlatformProcess::CloseProc(ProcHandle);
 	FPlatformProcess::ClosePipe(ReadPipe, WritePipe);
+	
+	double ElapsedTime = FPlatformTime::Seconds() - StartTime;
+
+	if (bCancelled)
+	{
+		UE_LOG(LogUnrealSharpProcHelper, Display, TEXT("%s with args (%s) was cancelled after %f seconds."), *ProgramName, *Arguments, ElapsedTime);
+		return false;
+	}
 
 	if (OutReturnCode != 0)
 	{
 		UE_LOG(LogUnrealSharpProcHelper, Error, TEXT("%s task failed (Args: %s) with return code %d. Error: %s"), *ProgramName, *Arguments, OutReturnCode, *Output)
 		
-		FText DialogText = FText::FromString(FString::Printf(TEXT("%s task failed: \n %s"), *ProgramName, *Output));
-		FMessageDialog::Open(EAppMsgType::Ok, DialogText);
+		ShowProcErrorDialog(FString::Printf(TEXT("%s task failed: \n %s"), *ProgramName, *Output));
 		return false;
 	}
 
-	double EndTime = FPlatformTime::Seconds();
-	double ElapsedTime = EndTime - StartTime;
-	UE_LOG(LogUnrealSharpProcHelper, Log, TEXT("%s with args (%s) took %f seconds to execute."), *ProgramName, *Arguments, ElapsedTime);
+	UE_LOG(LogUnrealSharpProcHelper, Display, TEXT("%s with args (%s) took %f seconds to execute."), *ProgramName, *Arguments, ElapsedTime);
 	
 	return true;
 }
 
-bool FCSProcHelper::InvokeUnrealSharpBuildTool(EBuildAction BuildAction, EDotNetBuildConfiguration* BuildConfiguration, const FString* InOutputDirectory)
+bool FCSProcHelper::InvokeUnrealSharpBuildTool(EBuildAction BuildAction, EDotNetBuildConfiguration* BuildConfiguration, const FString* InOutputDirectory, const FThreadSafeBool* bCancelRequested)
+{
+	int32 ReturnCode = 0;
+	FString Output;
+	FString WorkingDirectory = GetAssembliesPath();
+	return InvokeCommand(GetDotNetExecutablePath(), GetUnrealSharpBuildToolArguments(BuildAction, BuildConfiguration), ReturnCode, Output, &WorkingDirectory, bCancelRequested);
+}
+
+FString FCSProcHelper::GetUnrealSharpBuildToolArguments(EBuildAction BuildAction, EDotNetBuildConfiguration* BuildConfiguration)
 {
 	FName BuildActionCommand = StaticEnum<EBuildAction>()->GetNameByValue(BuildAction);
 	FString PluginFolder = FPaths::ConvertRelativePathToFull(IPluginManager::Get().FindPlugin(UE_PLUGIN_NAME)->GetBaseDir());
@@ -93,11 +174,8 @@ bool FCSProcHelper::InvokeUnrealSharpBuildTool(EBuildAction BuildAction, EDotNet
 		FText BuildConfigurationString = StaticEnum<EDotNetBuildConfiguration>()->GetDisplayNameTextByValue(static_cast<int64>(*BuildConfiguration));
 		Args += FString::Printf(TEXT(" --BuildConfig %s"), *BuildConfigurationString.ToString());
 	}
-	
-	int32 ReturnCode = 0;
-	FString Output;
-	FString WorkingDirectory = GetAssembliesPath();
-	return InvokeCommand(DotNetPath, Args, ReturnCode, Output, &WorkingDirectory);
+
+	return Args;
 }
 
 bool FCSProcHelper::Clean()
@@ -139,7 +217,7 @@ FString FCSProcHelper::GetLatestHostFxrPath()
 		return "";
 	}
 	
-	return FPaths::Combine(HostFxrRoot, HighestVersion, HOSTFXR_WINDOWS);
+	return FPaths::Combine(HostFxrRoot, HighestVersion, HOSTFXR_PLATFORM);
 }
 
 FString FCSProcHelper::GetRuntimeHostPath()
@@ -147,7 +225,7 @@ FString FCSProcHelper::GetRuntimeHostPath()
 #if WITH_EDITOR
 	return GetLatestHostFxrPath();
 #else
-	return FPaths::Combine(GetAssembliesPath(), HOSTFXR_WINDOWS);
+	return FPaths::Combine(GetAssembliesPath(), HOSTFXR_PLATFORM);
 #endif
 }
 
@@ -192,6 +270,7 @@ FString FCSProcHelper::GetDotNetDirectory()
 	TArray<FString> Paths;
 	PathVariable.ParseIntoArray(Paths, FPlatformMisc::GetPathVarDelimiter());
 
+#if PLATFORM_WINDOWS
 	FString PathDotnet = "Program Files\\dotnet\\";
 	for (FString& Path : Paths)
 	{
@@ -208,12 +287,29 @@ FString FCSProcHelper::GetDotNetDirectory()
 			
 		return Path;
 	}
+#else
+	// DOTNET_ROOT is the documented way to point at an installation, then the usual install locations.
+	// The dotnet in /usr/bin is a symlink, so the PATH only helps when it holds the installation itself.
+	TArray<FString> Candidates;
+	Candidates.Add(FPlatformMisc::GetEnvironmentVariable(TEXT("DOTNET_ROOT")));
+	Candidates.Add(TEXT("/usr/share/dotnet"));
+	Candidates.Add(TEXT("/usr/lib/dotnet"));
+	Candidates.Append(Paths);
+
+	for (const FString& Candidate : Candidates)
+	{
+		if (!Candidate.IsEmpty() && FPaths::FileExists(Candidate / DOTNET_EXECUTABLE) && FPaths::DirectoryExists(Candidate / TEXT("host") / TEXT("fxr")))
+		{
+			return Candidate / TEXT("");
+		}
+	}
+#endif
 	return "";
 }
 
 FString FCSProcHelper::GetDotNetExecutablePath()
 {
-	return GetDotNetDirectory() + "dotnet.exe";
+	return GetDotNetDirectory() + DOTNET_EXECUTABLE;
 }
 
 FString& FCSProcHelper::GetPluginDirectory()
@@ -1,5 +1,7 @@
 ﻿#pragma once
 
+#include "HAL/ThreadSafeBool.h"
+
 UENUM()
 enum EBuildAction
 {
@@ -8,6 +10,7 @@ enum EBuildAction
 	GenerateProject,
 	Rebuild,
 	Weave,
+	BuildServer,
 };
 
 UENUM()
@@ -21,14 +24,30 @@ enum class EDotNetBuildConfiguration : uint64
 #define HOSTFXR_WINDOWS "hostfxr.dll"
 #define HOSTFXR_MAC "libhostfxr.dylib"
 #define HOSTFXR_LINUX "libhostfxr.so"
+
+#if PLATFORM_WINDOWS
+#define HOSTFXR_PLATFORM HOSTFXR_WINDOWS
+#define DOTNET_EXECUTABLE "dotnet.exe"
+#elif PLATFORM_MAC
+#define HOSTFXR_PLATFORM HOSTFXR_MAC
+#define DOTNET_EXECUTABLE "dotnet"
+#else
+#define HOSTFXR_PLATFORM HOSTFXR_LINUX
+#define DOTNET_EXECUTABLE "dotnet"
+#endif
 #define DOTNET_MAJOR_VERSION "8.0.0"
 
 class UNREALSHARPPROCHELPER_API FCSProcHelper final
 {
 public:
 	
-	static bool InvokeCommand(const FString& ProgramPath, const FString& Arguments, int32& OutReturnCode, FString& Output, FString* InWorkingDirectory = nullptr);
-	static bool InvokeUnrealSharpBuildTool(EBuildAction BuildAction, EDotNetBuildConfiguration* BuildConfiguration = nullptr, const FString* OutputDirectory = nullptr);
+	// Runs a program to completion, streaming its output to the log line by line.
+	// Setting bCancelRequested from another thread terminates the program and makes this return false.
+	static bool InvokeCommand(const FString& ProgramPath, const FString& Arguments, int32& OutReturnCode, FString& Output, FString* InWorkingDirectory = nullptr, const FThreadSafeBool* bCancelRequested = nullptr);
+	static bool InvokeUnrealSharpBuildTool(EBuildAction BuildAction, EDotNetBuildConfiguration* BuildConfiguration = nullptr, const FString* OutputDirectory = nullptr, const FThreadSafeBool* bCancelRequested = nullptr);
+
+	// Arguments for running UnrealSharpBuildTool through dotnet with the given action.
+	static FString GetUnrealSharpBuildToolArguments(EBuildAction BuildAction, EDotNetBuildConfiguration* BuildConfiguration = nullptr);
 	
 	static bool Clean();
 	static bool GenerateProject();